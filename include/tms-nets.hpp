@@ -21,6 +21,8 @@
 #include "tms-nets/details/genmat.hpp"
 // Include analysis
 #include "tms-nets/analysis/analysis.hpp"
+// Include integration
+#include "tms-nets/qmc/integrator.hpp"
 
 
 
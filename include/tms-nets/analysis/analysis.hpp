@@ -54,7 +54,11 @@ namespace tms::analysis
 	 * and \c Sobol nets provided in this library. Their generating matrices are \b guaranteed to
 	 * always be non-degenerate. If you discover a case when this function fails to perform on these
 	 * nets, [<b>report a bug</b>](https://github.com/jointpoints/tms-nets/issues/new).
-	 * 
+	 *
+	 * @note Projections are checked in parallel on the thread pool of the library
+	 * (see \ref tms::parallel::ThreadPool::global). Threads share the least value found so far,
+	 * so that projections which can't lower it are skipped early.
+	 *
 	 * @paragraph References
 	 * 1. Marion P., Godin M., L'Ecuyer P. (2020) An algorithm to compute the t-value of a digital
 	 * net and of its projections. *Journal of Computational and Applied Mathematics*. **371**. 112669.
@@ -62,6 +66,116 @@ namespace tms::analysis
 	 */
 	BasicInt            t               (DigitalNet const &net);
 
+	/**
+	 * Values of \f$t\f$ for projections of a digital net
+	 *
+	 * The value for the projection onto coordinates \f$c_0 < c_1 < \ldots < c_{u - 1}\f$ is stored in
+	 * <tt>values[u - 1]</tt> at the index \f$\sum_{i = 0}^{u - 1} \binom{c_i}{i + 1}\f$, i.e. projections
+	 * of each order are sorted colexicographically.
+	 */
+	struct TProjections
+	{
+		/// Dimension of the net
+		BasicInt                             s;
+		/// Values of \f$t\f$ of projections of orders from \f$1\f$ to the maximal one
+		std::vector< std::vector<BasicInt> > values;
+
+		/// Returns the maximal order of stored projections
+		BasicInt              max_order   (void) const;
+
+		/**
+		 * Returns the index of a projection in <tt>values[coordinates.size() - 1]</tt>
+		 *
+		 * @param   coordinates     Coordinates of a projection sorted in the ascending order.
+		 */
+		CountInt              index       (std::vector<BasicInt> const &coordinates) const;
+
+		/**
+		 * Returns coordinates of a projection sorted in the ascending order
+		 *
+		 * @param   order   Order of a projection.
+		 * @param   index   Index of a projection in <tt>values[order - 1]</tt>.
+		 */
+		std::vector<BasicInt> coordinates (BasicInt order, CountInt index) const;
+
+		/**
+		 * Returns \f$t\f$ of a projection
+		 *
+		 * @param   coordinates     Coordinates of a projection sorted in the ascending order.
+		 *
+		 * @throws  out_of_range    If coordinates are not sorted, exceed \f$s\f$ or there are more of them
+		 *                          than the maximal order.
+		 */
+		BasicInt              t           (std::vector<BasicInt> const &coordinates) const;
+
+		/**
+		 * Returns the largest \f$t\f$ over projections of the given order
+		 *
+		 * @param   order   Order of projections from \f$1\f$ to the maximal one.
+		 */
+		BasicInt              max_t       (BasicInt order) const;
+
+		/**
+		 * Returns the mean \f$t\f$ over projections of the given order
+		 *
+		 * @param   order   Order of projections from \f$1\f$ to the maximal one.
+		 */
+		Real                  mean_t      (BasicInt order) const;
+	};
+
+	/**
+	 * Calculates precise values of \f$t\f$ for all projections of a digital net up to the given order
+	 *
+	 * All projections are handled in a single pass from lower orders to higher ones. Since \f$t\f$ of
+	 * a projection is never less than the one of its subprojections, checks of every projection start
+	 * from the values already found for its subprojections of the previous order. Projections of the
+	 * same order are checked in parallel on the thread pool of the library.
+	 *
+	 * @param   net         A digital net.
+	 * @param   max_order   Maximal order of projections from \f$1\f$ to \f$s\f$.
+	 *
+	 * @returns Values of \f$t\f$ for all projections of orders from \f$1\f$ to \c max_order. The value of
+	 * the projection of order \f$s\f$ equals \ref t(net).
+	 *
+	 * @throws  invalid_argument    If at least one generating matrix of the given net is degenerate or
+	 *                              \c max_order is not in \f$[1, s]\f$.
+	 *
+	 * @paragraph References
+	 * 1. Marion P., Godin M., L'Ecuyer P. (2020) An algorithm to compute the t-value of a digital
+	 * net and of its projections. *Journal of Computational and Applied Mathematics*. **371**. 112669.
+	 * https://doi.org/10.1016/j.cam.2019.112669
+	 */
+	TProjections        t_projections   (DigitalNet const &net, BasicInt max_order);
+
+	/**
+	 * Calculates the \f$L_2\f$-star discrepancy
+	 *
+	 * Finds the precise value of the \f$L_2\f$-norm of the local discrepancy over anchored boxes
+	 * \f$[0, x)\f$ by Warnock's formula
+	 * \f[
+	 * D_2^2 = 3^{-s} - \frac{2^{1 - s}}{N} \sum_{i} \prod_{k} (1 - x_{ik}^2) + \frac{1}{N^2} \sum_{i, j}
+	 * \prod_{k} (1 - \max(x_{ik}, x_{jk})).
+	 * \f]
+	 * The sum over pairs of points is found either by Heinrich's divide and conquer in \f$O(N (\log N)^s)\f$
+	 * operations or directly in \f$O(N^2 s)\f$ operations, whichever is estimated to be faster: the former
+	 * is chosen for small \f$s\f$, e.g. for \f$s \le 6\f$ if \f$m = 20\f$.
+	 *
+	 * @param   net     A digital net.
+	 *
+	 * @returns \f$L_2\f$-star discrepancy of points of the given digital net.
+	 *
+	 * @note Both ways run on the thread pool of the library and sum their parts in a fixed order, so the
+	 * result doesn't depend on the amount of threads. Pairs of points are processed in tiles that fit
+	 * in the cache of a core.
+	 *
+	 * @paragraph References
+	 * 1. Warnock T. T. (1972) Computational investigations of low-discrepancy point sets. *Applications
+	 * of Number Theory to Numerical Analysis*. 319–343.
+	 * 2. Heinrich S. (1996) Efficient algorithms for computing the L2-discrepancy. *Mathematics of
+	 * Computation*. **65**(216). 1621–1633.
+	 */
+	Real                l2_star_discrepancy(DigitalNet const &net);
+
 	///@}
 
 
@@ -87,6 +201,7 @@ namespace tms::analysis
 	 * vector will be positive, otherwise, negative.
 	 * 
 	 * @param   net     A digital net.
+	 * @param   threads Amount of threads to use, 0 stands for all threads of the pool.
 	 * 
 	 * @returns A \ref tms::Point the \f$i\f$-th component of which equals the scatter defect along
 	 * the \f$i\f$-th principal axis.
@@ -94,12 +209,64 @@ namespace tms::analysis
 	 * @note Principal axes always form an orthonormal basis in the \f$s\f$-dimensional space,
 	 * however, there are <i>no guarantees</i> that they will match with the basis that is used to
 	 * express the coordinates of digital net points.
-	 * 
+	 *
+	 * @note Points are walked in parts on the thread pool of the library. The covariance matrix is
+	 * accumulated from scaled integer coordinates exactly, so the result doesn't depend on the amount
+	 * of threads. Its eigenvalues are found by Jacobi's method in \ref tms::Real for \f$s \le 64\f$ and by
+	 * \ref tms::eigen::symmetric_eigenvalues in \c double for larger \f$s\f$.
+	 *
 	 * @paragraph References
 	 * 1. Eliseev A. (2020) Properties of (t, s)-sequences and their verification. Bachelor's
 	 * graduation work (in Russian).
 	 */
-	tms::Point          scatter_defect  (DigitalNet const &net);
+	tms::Point          scatter_defect  (DigitalNet const &net, unsigned int threads = 0);
+
+	/**
+	 * Elementary interval \f$\prod_{k} [a_k 2^{-d_k}, (a_k + 1) 2^{-d_k})\f$ in base \f$2\f$ and the amount
+	 * of net points in it
+	 */
+	struct ElementaryInterval
+	{
+		/// Amounts \f$d_k\f$ of binary digits fixed along each coordinate
+		std::vector<BasicInt> digits;
+		/// Values \f$a_k\f$ of the fixed digits along each coordinate
+		std::vector<CountInt> positions;
+		/// Amount of net points in the interval
+		CountInt              points;
+	};
+
+	/// Result of the verification of equidistribution of a digital net
+	struct EquidistributionReport
+	{
+		/// Whether every elementary interval of the volume \f$2^{t - m}\f$ contains exactly \f$2^t\f$ points
+		bool               equidistributed;
+		/// An interval with a wrong amount of points, it is filled only if the net is not equidistributed
+		ElementaryInterval counterexample;
+	};
+
+	/**
+	 * Verifies that a digital net is a \f$(t, m, s)\f$-net by counting its points
+	 *
+	 * Unlike \ref t, generating matrices are not analysed. Points are generated once and, for each
+	 * composition \f$d_0 + \ldots + d_{s - 1} = m - t\f$, the points are bucketed into elementary
+	 * intervals by the highest \f$d_k\f$ digits of their scaled coordinates in a single pass over them.
+	 * Compositions are checked in parallel on the thread pool of the library.
+	 *
+	 * @param   net     A digital net.
+	 * @param   t       Expected value of \f$t\f$.
+	 *
+	 * @returns Whether the given digital net is a \f$(t, m, s)\f$-net and, if it is not, the first
+	 * elementary interval with a wrong amount of points. Compositions are ordered lexicographically and
+	 * intervals of a composition are ordered by their digits, so the reported interval doesn't depend on
+	 * the amount of threads.
+	 *
+	 * @throws  invalid_argument    If \f$t > m\f$.
+	 * @throws  length_error        If \f$m - t > 32\f$ or there are too many compositions.
+	 *
+	 * @note Every composition takes \f$O(N)\f$ operations, and there are \f$\binom{m - t + s - 1}{s - 1}\f$ of
+	 * them, hence this function is only practical for moderate values of \f$m - t\f$ and \f$s\f$.
+	 */
+	EquidistributionReport verify_equidistribution(DigitalNet const &net, BasicInt t);
 
 	/// @}
 
@@ -0,0 +1,250 @@
+/**
+ * @file    bitops.hpp
+ *
+ * @brief   Contains portable helpers for word-level bit manipulations.
+ */
+#ifndef TMS_NETS_BITOPS_HPP
+#define TMS_NETS_BITOPS_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+
+/** @namespace tms::bitops
+ *  @brief Contains portable helpers for word-level bit manipulations */
+namespace tms::bitops
+{
+	
+	/** Returns the number of trailing zero bits of a word (its position of the lowest set bit)
+	 *  @param [in] word - nonzero word */
+	inline unsigned int
+	count_trailing_zeros(uint64_t word)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<unsigned int>(__builtin_ctzll(word));
+#else
+		unsigned int count = 0;
+		while ( (word & 1) == 0 )
+		{
+			word >>= 1;
+			++count;
+		}
+		return count;
+#endif
+	}
+	
+	/** Returns the position of the highest set bit of a word
+	 *  @param [in] word - nonzero word */
+	inline unsigned int
+	highest_bit(uint64_t word)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return 63 - static_cast<unsigned int>(__builtin_clzll(word));
+#else
+		unsigned int position = 0;
+		while ( word >>= 1 )
+		{
+			++position;
+		}
+		return position;
+#endif
+	}
+	
+	/** Returns the number of set bits of a word
+	 *  @param [in] word - word */
+	inline unsigned int
+	count_ones(uint64_t word)
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		return static_cast<unsigned int>(__builtin_popcountll(word));
+#else
+		unsigned int count = 0;
+		while ( word != 0 )
+		{
+			word &= word - 1;
+			++count;
+		}
+		return count;
+#endif
+	}
+	
+	/** Returns the lower word of the 128-bit product of two words
+	 *  @param [in] a - first factor
+	 *  @param [in] b - second factor
+	 *  @param [out] high - the higher word of the product */
+	inline uint64_t
+	multiply_wide(uint64_t a, uint64_t b, uint64_t &high)
+	{
+#if defined(__SIZEOF_INT128__)
+		unsigned __int128 const product = static_cast<unsigned __int128>(a)*b;
+		high = static_cast<uint64_t>(product >> 64);
+		return static_cast<uint64_t>(product);
+#else
+		uint64_t const a_lo = a & 0xFFFFFFFFULL, a_hi = a >> 32;
+		uint64_t const b_lo = b & 0xFFFFFFFFULL, b_hi = b >> 32;
+		uint64_t const lo_lo = a_lo*b_lo;
+		uint64_t const hi_lo = a_hi*b_lo;
+		uint64_t const lo_hi = a_lo*b_hi;
+		uint64_t const middle = (lo_lo >> 32) + (hi_lo & 0xFFFFFFFFULL) + lo_hi;
+		high = a_hi*b_hi + (hi_lo >> 32) + (middle >> 32);
+		return (middle << 32) | (lo_lo & 0xFFFFFFFFULL);
+#endif
+	}
+
+	/** @class ExactSum
+	 *  @brief Exact sum of products of words kept as a 192-bit two's complement number.
+	 *
+	 *  Sums over \f$2^m\f$ points of products of coordinates scaled by \f$2^m\f$ never exceed \f$2^{3m}\f$,
+	 *  so for \f$m < 64\f$ they are exact and don't depend on the order of summation. */
+	class ExactSum
+	{
+	public:
+		
+		/** Adds the product of two words
+		 *  @param [in] a - first factor
+		 *  @param [in] b - second factor */
+		void add_product(uint64_t a, uint64_t b)
+		{
+			uint64_t high;
+			uint64_t const low = multiply_wide(a, b, high);
+			add(low, high, 0);
+		}
+		
+		ExactSum& operator +=(ExactSum const &r)
+		{
+			add(r.m_words[0], r.m_words[1], r.m_words[2]);
+			return *this;
+		}
+		
+		ExactSum& operator -=(ExactSum const &r)
+		{
+			// adds the two's complement of the subtrahend
+			uint64_t const low    = ~r.m_words[0] + 1;
+			uint64_t const carry0 = low == 0;
+			uint64_t const middle = ~r.m_words[1] + carry0;
+			uint64_t const carry1 = carry0 && middle == 0;
+			add(low, middle, ~r.m_words[2] + carry1);
+			return *this;
+		}
+		
+		/** Multiplies the sum by \f$2^{shift}\f$
+		 *  @param [in] shift - power of two less than 64 */
+		ExactSum& operator <<=(unsigned int shift)
+		{
+			if ( shift != 0 )
+			{
+				m_words[2] = (m_words[2] << shift) | (m_words[1] >> (64 - shift));
+				m_words[1] = (m_words[1] << shift) | (m_words[0] >> (64 - shift));
+				m_words[0] <<= shift;
+			}
+			return *this;
+		}
+		
+		/** Returns the sum multiplied by \f$2^{-shift}\f$ rounded to long double
+		 *  @param [in] shift - power of two */
+		long double value(int shift) const
+		{
+			bool const negative = (m_words[2] >> 63) != 0;
+			ExactSum   magnitude;
+			if ( negative )
+			{
+				magnitude -= *this;
+			}
+			else
+			{
+				magnitude = *this;
+			}
+			long double const word = std::ldexp(1.0L, 64);
+			long double const res  = (static_cast<long double>(magnitude.m_words[2])*word + magnitude.m_words[1])*word + magnitude.m_words[0];
+			return std::ldexp(negative ? -res : res, -shift);
+		}
+		
+		/** Adds a number given by its words
+		 *  @param [in] low, middle, high - words of the 192-bit two's complement number, the lowest first */
+		void add(uint64_t low, uint64_t middle, uint64_t high)
+		{
+			m_words[0] += low;
+			uint64_t const carry0 = m_words[0] < low;
+			m_words[1] += middle;
+			uint64_t carry1 = m_words[1] < middle;
+			m_words[1] += carry0;
+			carry1 += m_words[1] < carry0;
+			m_words[2] += high + carry1;
+		}
+		
+		/** Returns a word of the two's complement representation
+		 *  @param [in] index - number of the word from 0 to 2, the lowest first */
+		uint64_t word(unsigned int index) const
+		{
+			return m_words[index];
+		}
+		
+		
+	private:
+		
+		uint64_t m_words[3] = {0, 0, 0};
+	};
+	
+	/** Returns the XOR of all bits of a word
+	 *  @param [in] word - word */
+	inline unsigned int
+	parity(uint64_t word)
+	{
+		return count_ones(word) & 1;
+	}
+
+	/** Transposes a 64x64 bit matrix in place: after the call the k-th bit of block[p] is equal to the p-th bit
+	 *  of block[k] before the call. Off-diagonal sub-blocks of halving width are swapped.
+	 *  @param [in,out] block - 64 words, the p-th word is the p-th row of the matrix */
+	inline void
+	transpose(uint64_t *block)
+	{
+		uint64_t mask = 0x00000000FFFFFFFFULL;
+		for (unsigned int width = 32; width != 0; width >>= 1, mask ^= mask << width)
+		{
+			for (unsigned int p = 0; p < 64; p = (p + width + 1) & ~width)
+			{
+				uint64_t const swapped = ((block[p] >> width) ^ block[p + width]) & mask;
+				block[p]         ^= swapped << width;
+				block[p + width] ^= swapped;
+			}
+		}
+	}
+
+
+	/// Highest amount of bits of a scaled coordinate that to_unit_double converts exactly
+	unsigned int const exact_double_bits = 52;
+	/// Highest amount of bits of a scaled coordinate that to_unit_float converts exactly
+	unsigned int const exact_float_bits  = 23;
+	
+	/** Returns \f$scaled \cdot 2^{-nbits}\f$ as a double from \f$[0, 1)\f$ without integer conversion and multiplication:
+	 *  the bits are placed into the mantissa of a number from \f$[1, 2)\f$ and \f$1\f$ is subtracted.
+	 *  @param [in] scaled - integer less than \f$2^{nbits}\f$
+	 *  @param [in] nbits - amount of bits, not greater than exact_double_bits */
+	inline double
+	to_unit_double(uint64_t scaled, unsigned int nbits)
+	{
+		uint64_t const bits = 0x3FF0000000000000ULL | (scaled << (exact_double_bits - nbits));
+		double value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value - 1.0;
+	}
+	
+	/** Returns \f$scaled \cdot 2^{-nbits}\f$ as a float from \f$[0, 1)\f$ without integer conversion and multiplication:
+	 *  the bits are placed into the mantissa of a number from \f$[1, 2)\f$ and \f$1\f$ is subtracted.
+	 *  @param [in] scaled - integer less than \f$2^{nbits}\f$
+	 *  @param [in] nbits - amount of bits, not greater than exact_float_bits */
+	inline float
+	to_unit_float(uint64_t scaled, unsigned int nbits)
+	{
+		uint32_t const bits = 0x3F800000U | static_cast<uint32_t>(scaled << (exact_float_bits - nbits));
+		float value;
+		std::memcpy(&value, &bits, sizeof(value));
+		return value - 1.0f;
+	}
+	
+}
+
+
+#endif // #ifndef TMS_NETS_BITOPS_HPP
@@ -0,0 +1,127 @@
+/**
+ * @file    bitpoly.hpp
+ *
+ * @brief   Contains polynomials over GF(2) with bit-packed coefficients.
+ */
+#ifndef TMS_NETS_BITPOLY_HPP
+#define TMS_NETS_BITPOLY_HPP
+
+#include <cstdint>
+#include <iosfwd>
+#include <utility>
+#include <vector>
+
+
+namespace tms
+{
+
+	/** @class BitPoly
+	 *  @brief Represents a polynomial over GF(2). Coefficients are packed into 64-bit words: the coefficient of
+	 *         \f$x^n\f$ is the \f$(n \bmod 64)\f$-th bit of the \f$\lfloor n/64 \rfloor\f$-th word.
+	 *         The highest word is always nonzero, zero polynomial has no words. */
+	class BitPoly
+	{
+	public:
+
+		/// Creates zero polynomial
+		BitPoly(void);
+
+		/** Creates polynomial with the coefficients packed into a number
+		 *  @param [in] coeffs_number - number which n-th bit is the coefficient of \f$x^n\f$ */
+		explicit BitPoly(uint64_t coeffs_number);
+
+		/** Creates polynomial with the specified coefficients
+		 *  @param [in] coeffs - coefficients from the lowest degree to the highest one, only their parity is used */
+		BitPoly(std::vector<uintmax_t> const &coeffs);
+
+		/** Creates polynomial from packed words
+		 *  @param [in] words - words of coefficients, the lowest word first */
+		static BitPoly from_words(std::vector<uint64_t> words);
+
+		/// Checks whether polynomial is zero
+		bool      is_zero(void) const;
+
+		/// Returns amount of coefficients, i.e. degree + 1 for nonzero polynomial and 0 for zero one
+		uintmax_t size(void) const;
+
+		/// Returns degree of polynomial, throws std::logic_error for zero polynomial
+		uintmax_t degree(void) const;
+
+		/** Returns coefficient of \f$x^n\f$
+		 *  @param [in] n - power, coefficients beyond the degree are zero */
+		uintmax_t operator [](uintmax_t n) const;
+
+		/// Returns packed words of coefficients
+		std::vector<uint64_t> const &words(void) const;
+
+		BitPoly& operator ^=(BitPoly const &r);
+		BitPoly& operator +=(BitPoly const &r);
+		BitPoly& operator *=(BitPoly const &r);
+		BitPoly& operator /=(BitPoly const &r);
+		BitPoly& operator %=(BitPoly const &r);
+		BitPoly& operator <<=(uintmax_t shift);
+		BitPoly& operator >>=(uintmax_t shift);
+
+		friend bool operator ==(BitPoly const &l, BitPoly const &r);
+
+
+	private:
+
+		/// Removes zero highest words
+		void normalize(void);
+
+		std::vector<uint64_t> m_words;
+	};
+
+	BitPoly operator ^ (BitPoly l, BitPoly const &r);
+	BitPoly operator + (BitPoly l, BitPoly const &r);
+	BitPoly operator * (BitPoly const &l, BitPoly const &r);
+	BitPoly operator / (BitPoly const &l, BitPoly const &r);
+	BitPoly operator % (BitPoly const &l, BitPoly const &r);
+	BitPoly operator <<(BitPoly l, uintmax_t shift);
+	BitPoly operator >>(BitPoly l, uintmax_t shift);
+	bool    operator ==(BitPoly const &l, BitPoly const &r);
+	bool    operator !=(BitPoly const &l, BitPoly const &r);
+
+	/** Divides polynomials with remainder using shift-xor long division, throws std::logic_error if divisor is zero
+	 *  @param [in] dividend - dividend
+	 *  @param [in] divisor - divisor
+	 *  @return pair of quotient and remainder */
+	std::pair<BitPoly, BitPoly> divide(BitPoly const &dividend, BitPoly const &divisor);
+
+	/** Returns greatest common divisor of polynomials computed with binary (Stein's) algorithm
+	 *  @param [in] a - first polynomial
+	 *  @param [in] b - second polynomial */
+	BitPoly gcd(BitPoly a, BitPoly b);
+
+	/** Checks whether polynomial is irreducible over GF(2) using Ben-Or's test
+	 *  @param [in] poly - polynomial of positive degree */
+	bool    is_irreducible(BitPoly const &poly);
+
+	/** Checks whether polynomial of degree less than 64 packed into a number is irreducible over GF(2), the same
+	 *  as is_irreducible(BitPoly(coeffs_number)) but without memory allocation
+	 *  @param [in] coeffs_number - number which n-th bit is the coefficient of \f$x^n\f$ */
+	bool    is_irreducible_word(uint64_t coeffs_number);
+
+	std::ostream& operator <<(std::ostream &out, BitPoly const &poly);
+
+
+
+
+
+	inline bool
+	BitPoly::is_zero(void) const
+	{ return m_words.empty(); }
+
+	inline uintmax_t
+	BitPoly::operator [](uintmax_t n) const
+	{ return n/64 < m_words.size() ? (m_words[n/64] >> (n % 64)) & 1 : 0; }
+
+	inline std::vector<uint64_t> const &
+	BitPoly::words(void) const
+	{ return m_words; }
+
+}
+
+
+#endif
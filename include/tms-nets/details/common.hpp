@@ -1,8 +1,10 @@
 #ifndef TMS_NETS_COMMON_HPP
 #define TMS_NETS_COMMON_HPP
 
-#include "../thirdparty/irrpoly/gfcheck.hpp"
+#include "bitpoly.hpp"
 
+#include <cstdint>
+#include <initializer_list>
 #include <vector>
 #include <stdexcept>
 
@@ -24,7 +26,7 @@ namespace tms
 	/// Represents a point of a (t, m, s)-net
 	using Point	     = std::vector<Real>;
 	/// Represents a polynomial over GF[2]
-	using Polynomial = irrpoly::gfpoly;
+	using Polynomial = BitPoly;
 	
 	
 	/// Highest allowed m parameter value of created nets, i.e. highest bit depth value
@@ -109,11 +111,34 @@ namespace tms
 	bool   operator !=(GenNum const &l, GenNum const &r);
 	
 	
-	/** Represents a row of a generating matrix */
+	/** Represents a row of a generating matrix. Elements are packed into a single word: the n-th element is
+	 *  the (size - 1 - n)-th bit, i.e. the row is read from the highest bit as generating numbers are. */
 	class GenMatRow
 	{
 	public:
 		
+		/** Proxy for an element of a row that behaves like a reference to uint8_t holding 0 or 1 */
+		class Reference
+		{
+		public:
+			
+			operator uint8_t(void) const;
+			
+			Reference& operator =(uint8_t value);
+			Reference& operator =(Reference const &r);
+			Reference& operator ^=(uint8_t value);
+			
+			friend GenMatRow;
+			
+			
+		private:
+			
+			Reference(uint64_t &bits, uint64_t mask);
+			
+			uint64_t &m_bits;
+			uint64_t  m_mask;
+		};
+		
 		GenMatRow(void);
 		GenMatRow(GenMatRow const&);
 		GenMatRow(GenMatRow &&);
@@ -127,11 +152,19 @@ namespace tms
 		GenMatRow(std::vector<uint8_t> const &values_vector); //?
 		GenMatRow(std::initializer_list<uint8_t> const &values_list);
 		
-		bool     empty(void) const;
+		/** Creates row from packed elements
+		 *  @param [in] size - amount of elements
+		 *  @param [in] bits - word which (size - 1 - n)-th bit is the n-th element, higher bits are ignored */
+		static GenMatRow from_bits(BasicInt size, uint64_t bits);
+		
+		bool      empty(void) const;
+		
+		BasicInt  size(void) const;
+		uint8_t   operator [](BasicInt n) const;
+		Reference operator [](BasicInt n);
 		
-		BasicInt size(void) const;
-		uint8_t  operator [](BasicInt n) const;
-		uint8_t& operator [](BasicInt n);
+		/// Returns packed elements: the n-th element is the (size - 1 - n)-th bit
+		uint64_t  bits(void) const;
 		
 		GenMatRow& operator ^= (GenMatRow const &r);
 		GenMatRow& operator >>=(BasicInt s);
@@ -145,7 +178,11 @@ namespace tms
 		
 	private:
 		
-		std::vector<uint8_t> m_values;
+		/// Returns the mask of size lowest bits
+		static uint64_t mask(BasicInt size);
+		
+		BasicInt m_size = 0;
+		uint64_t m_bits = 0;
 	};
 	
 	bool      operator ==(GenMatRow const &l, GenMatRow const &r);
@@ -156,6 +193,8 @@ namespace tms
 	GenMatRow operator * (GenMatRow l, bool m);
 	
 	
+	/** Represents a generating matrix as a vector of packed rows, so the whole matrix is a single memory block
+	 *  and operations on it work with whole rows */
 	class GenMat
 	{
 	public:
@@ -235,21 +274,52 @@ namespace tms
 
 
 
+	inline
+	GenMatRow::Reference::Reference(uint64_t &bits, uint64_t mask) :
+	    m_bits(bits),
+	    m_mask(mask)
+	{}
+
+	inline
+	GenMatRow::Reference::operator uint8_t(void) const
+	{ return (m_bits & m_mask) != 0; }
+
+	inline GenMatRow::Reference&
+	GenMatRow::Reference::operator =(uint8_t value)
+	{ m_bits = (value & 1) ? m_bits | m_mask : m_bits & ~m_mask; return *this; }
+
+	inline GenMatRow::Reference&
+	GenMatRow::Reference::operator =(Reference const &r)
+	{ return *this = static_cast<uint8_t>(r); }
+
+	inline GenMatRow::Reference&
+	GenMatRow::Reference::operator ^=(uint8_t value)
+	{ m_bits ^= (value & 1) ? m_mask : 0; return *this; }
+
+
 	inline bool
 	GenMatRow::empty(void) const
-	{ return m_values.empty(); }
+	{ return m_size == 0; }
 	
 	inline BasicInt
 	GenMatRow::size(void) const
-	{ return static_cast<BasicInt>(m_values.size()); }
+	{ return m_size; }
 
 	inline uint8_t
 	GenMatRow::operator [](BasicInt n) const
-	{ return m_values[n]; }
+	{ return (m_bits >> (m_size - 1 - n)) & 1; }
 
-	inline uint8_t&
+	inline GenMatRow::Reference
 	GenMatRow::operator [](BasicInt n)
-	{ return m_values[n]; }
+	{ return Reference(m_bits, 1ULL << (m_size - 1 - n)); }
+
+	inline uint64_t
+	GenMatRow::bits(void) const
+	{ return m_bits; }
+
+	inline uint64_t
+	GenMatRow::mask(BasicInt size)
+	{ return size >= 64 ? ~0ULL : (1ULL << size) - 1; }
 
 
 
@@ -0,0 +1,32 @@
+/**
+ * @file    eigen.hpp
+ *
+ * @brief   Contains eigenvalue solvers for dense real matrices.
+ */
+#ifndef TMS_NETS_EIGEN_HPP
+#define TMS_NETS_EIGEN_HPP
+
+#include <cstddef>
+#include <vector>
+
+
+/** @namespace tms::eigen
+ *  @brief Contains eigenvalue solvers for dense real matrices */
+namespace tms::eigen
+{
+	
+	/** Computes eigenvalues of a symmetric matrix without eigenvectors. The matrix is reduced to a tridiagonal
+	 *  one by Householder reflections, whose eigenvalues are found by the implicit QL algorithm with Wilkinson's
+	 *  shifts. It takes \f$\frac{4}{3}n^3\f$ operations for the reduction and \f$O(n^2)\f$ for the rest, unlike
+	 *  \f$O(n^3)\f$ per sweep of Jacobi's method. Rows of large matrices are updated on the thread pool of the library.
+	 *  @param [in] matrix - elements of the symmetric matrix in row-major order, it is used as the scratch space
+	 *  @param [in] size - amount of rows of the matrix
+	 *  @return eigenvalues in decreasing order
+	 *  @throws std::length_error if the matrix has not size*size elements
+	 *  @throws std::runtime_error if QL iterations don't converge */
+	std::vector<double> symmetric_eigenvalues(std::vector<double> matrix, std::size_t size);
+	
+}
+
+
+#endif // #ifndef TMS_NETS_EIGEN_HPP
@@ -3,6 +3,9 @@
 
 #include "common.hpp"
 
+#include <cstdint>
+#include <vector>
+
 
 namespace tms::genmat
 {	
@@ -12,6 +15,66 @@ namespace tms::genmat
 	GenMat make_phi(GenMat const &a, GenMat const &b);
 	
 	GenMat make_psi(GenMat const &a, GenMat const &b);
+	
+	
+	/** @class M4RMTable
+	 *  @brief Table of the Method of Four Russians: sums of all subsets of every group_size consecutive words of
+	 *         a matrix. The sum of the words selected by the bits of a packed vector then takes one lookup per
+	 *         group_size bits of the vector instead of one xor per set bit. */
+	class M4RMTable
+	{
+	public:
+		
+		/// Highest amount of words summed up in a single group of the table
+		static BasicInt const max_group_size = 8;
+		
+		/** Builds the table.
+		 *  @param [in] words - words of a matrix, the k-th of them is selected by the (size - 1 - k)-th bit of a vector:
+		 *                      rows of the right factor of a product of packed rows (GenMatRow::bits) or
+		 *                      columns of the left factor of a product by generating numbers
+		 *  @param [in] size - amount of words, not greater than max_nbits
+		 *  @param [in] group_size - amount of words in a group: the table has \f$2^{group\_size}\f$ sums per group, so
+		 *                           small groups suit a few products and large ones suit many */
+		M4RMTable(uint64_t const *words, BasicInt size, BasicInt group_size = max_group_size);
+		
+		/** Returns the sum of the words selected by the bits of a vector
+		 *  @param [in] bits - packed vector, its bits starting from size are ignored */
+		uint64_t operator ()(uint64_t bits) const;
+		
+		
+	private:
+		
+		BasicInt              m_group_size;
+		BasicInt              m_groups;
+		std::vector<uint64_t> m_sums;
+	};
+	
+	/** Multiplies every generating matrix by the same matrix from the left, the table of the matrix is built once.
+	 *  @param [in] left - matrix of size m
+	 *  @param [in] generating_numbers - generating numbers of matrices of size m */
+	std::vector<GenNum> multiply_left(GenMat const &left, std::vector<GenNum> const &generating_numbers);
+	
+	/** Multiplies every generating matrix by the same matrix from the right, the table of the matrix is built once
+	 *  and rows of generating matrices are obtained with a bit transposition.
+	 *  @param [in] generating_numbers - generating numbers of matrices of size m
+	 *  @param [in] right - matrix of size m */
+	std::vector<GenNum> multiply_right(std::vector<GenNum> const &generating_numbers, GenMat const &right);
+	
+	
+	
+	
+	
+	inline uint64_t
+	M4RMTable::operator ()(uint64_t bits) const
+	{
+		uint64_t const group_mask = (1ULL << m_group_size) - 1;
+		uint64_t       sum        = 0;
+		for (BasicInt group_i = 0; group_i < m_groups; ++group_i)
+		{
+			sum ^= m_sums[(group_i << m_group_size) + ((bits >> (group_i*m_group_size)) & group_mask)];
+		}
+		return sum;
+	}
 
 }
 
@@ -19,14 +19,16 @@
  *  @brief Contains specific polynomial-related functions that are necessary for (t,m,s)-net generation */
 namespace tms::gf2poly
 {
-	/** Returns polynomial over GF(2) with the specified coefficients (represents a wrapper above irrpoly::gfpoly constructor).
+	/** Returns polynomial over GF(2) with the specified coefficients (represents a wrapper above BitPoly constructor).
 	 *  @param [in] coeffs - desired polynomial coefficients */
 	Polynomial              make_gf2poly(std::vector<uintmax_t> const &coeffs);
 	/** Generates vector of first least-degree irreducible polynomials over GF(2).
 	 *  @param [in] amount - amount of irreducible polynomials to generate
 	 *  @param [in] max_defect - upper limit for sum of degrees of polynomials */
 	std::vector<Polynomial> generate_irrpolys(unsigned int const amount, unsigned int const max_defect = ~(unsigned int)(0));
-	/** Generates vector of first least-degree irreducible polynomials over GF(2) using multithreading.
+	/** Generates vector of first least-degree irreducible polynomials over GF(2) using multithreading. The result is
+	 *  the same as the one of generate_irrpolys: candidates are split into disjoint ranges, which are checked by
+	 *  separate tasks and merged in ascending order. The function may be called from several threads at once.
 	 *  @param [in] amount - amount of irreducible polynomials to generate
 	 *  @param [in] max_defect - upper limit for sum of degrees of polynomials */
 	std::vector<Polynomial> generate_irrpolys_in_parallel(unsigned int const amount, unsigned int const max_defect = ~(unsigned int)(0));
@@ -39,6 +41,41 @@ namespace tms::gf2poly
 	 *  @param [in] degree - greatest degree of generated polynomials */
 	std::vector<Polynomial> generate_irrpolys_until_degree(unsigned int const degree);
 	
+	
+	/// Highest degree of polynomials that are enumerated with the sieve, polynomials of higher degrees are tested one by one
+	unsigned int const sieve_max_degree = 24;
+	
+	/** Returns coefficient numbers of all irreducible polynomials over GF(2) of the specified degree in ascending order.
+	 *  They are taken from the precomputed table, sieved out of all polynomials of the degree by the products of
+	 *  irreducible polynomials of lower degrees (degree <= sieve_max_degree, the result is cached for the whole process)
+	 *  or checked with Ben-Or's test one by one.
+	 *  @param [in] degree - degree of polynomials, from 1 to 63 */
+	std::vector<uint64_t>   irreducible_masks_of_degree(unsigned int const degree);
+	/** Returns coefficient numbers of all irreducible polynomials over GF(2) with degrees <= max_degree in ascending order.
+	 *  @param [in] max_degree - greatest degree of polynomials, not greater than 63 */
+	std::vector<uint64_t>   irreducible_masks(unsigned int const max_degree);
+	/** Returns coefficient numbers of the same polynomials generate_irrpolys does: first least-degree irreducible
+	 *  polynomials over GF(2). Polynomials of a degree are enumerated only if they are needed.
+	 *  @param [in] amount - amount of irreducible polynomials to generate
+	 *  @param [in] max_defect - upper limit for sum of degrees of polynomials
+	 *  @param [in] in_parallel - whether to sieve and check polynomials on the thread pool, it doesn't change the result */
+	std::vector<uint64_t>   first_irreducible_masks(unsigned int const amount, unsigned int const max_defect = ~(unsigned int)(0),
+													bool const in_parallel = false);
+	
+	
+	/** @namespace tms::gf2poly::precomputed
+	 *  @brief Table of irreducible polynomials over GF(2) shipped with the library (source/details/irrpoly_table.cpp).
+	 *         It is left empty if the library is built with TMS_NO_IRRPOLY_TABLE defined. */
+	namespace precomputed
+	{
+		/// Highest degree of polynomials in the table, 0 for empty table
+		extern unsigned int const max_degree;
+		/// Amount of polynomials in the table
+		extern std::size_t  const count;
+		/// Coefficient numbers of all irreducible polynomials with degrees <= max_degree in ascending order
+		extern uint32_t     const masks[];
+	}
+	
 };
 
 
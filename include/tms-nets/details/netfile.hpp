@@ -0,0 +1,104 @@
+/**
+ * @file    netfile.hpp
+ *
+ * @brief   Contains the binary on-disk format of digital nets and its memory mapping.
+ */
+#ifndef TMS_NETS_NETFILE_HPP
+#define TMS_NETS_NETFILE_HPP
+
+#include "common.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+
+/** @namespace tms::netfile
+ *  @brief Contains the binary on-disk format of digital nets.
+ *
+ *  A file consists of a Header, the \f$k\f$-major table of generating numbers (the same one DigitalNet walks with
+ *  Gray's code) and the irreducible polynomials the net was built from. The table starts at a multiple of
+ *  table_alignment bytes, so when the file is mapped into memory it is used directly without parsing or copying.
+ *  All values are stored in the byte order of the machine that wrote the file; files with another byte order
+ *  or another version of the format are rejected. */
+namespace tms::netfile
+{
+
+	/// Version of the format, it is increased whenever the layout of the file changes
+	uint32_t const    format_version  = 1;
+
+	/// Alignment of the table of generating numbers in the file (and in the memory it is mapped to)
+	std::size_t const table_alignment = 64;
+
+	/** Kind of the net the file was saved from, nets may only be loaded by their own class or as a DigitalNet */
+	enum class NetKind : uint32_t
+	{
+		digital_net  = 0,
+		niederreiter = 1,
+		sobol        = 2
+	};
+
+	/** Header at the beginning of a file */
+	struct Header
+	{
+		/// "TMSNETS" followed by zero byte
+		char     magic[8];
+		/// Version of the format
+		uint32_t version;
+		/// 0x01020304 written in the byte order of the machine that wrote the file
+		uint32_t byte_order;
+		/// Value of NetKind
+		uint32_t kind;
+		/// \f$m\f$ parameter of the net
+		uint32_t nbits;
+		/// \f$s\f$ parameter of the net
+		uint32_t dim;
+		/// Size of a generating number in bytes
+		uint32_t word_size;
+		/// Offset of the table of \f$m \cdot s\f$ generating numbers in bytes
+		uint64_t table_offset;
+		/// Offset of the polynomials in bytes, every polynomial is the amount of its words followed by the words
+		uint64_t polys_offset;
+		/// Amount of the polynomials
+		uint64_t polys_count;
+		/// Size of the whole file in bytes
+		uint64_t file_size;
+	};
+
+	/** Net read from a file */
+	struct Contents
+	{
+		/// Header of the file
+		Header                          header;
+		/// \f$k\f$-major table of generating numbers: element \f$k \cdot s + i\f$ is the \f$k\f$-th number of dimension \f$i\f$.
+		/// It points into the mapped file, which stays mapped while any copy of the pointer is alive.
+		std::shared_ptr<GenNumInt const> table;
+		/// Irreducible polynomials of the net, empty if the net was not built from polynomials
+		std::vector<Polynomial>          irrpolys;
+	};
+
+	/** Writes a net into a file, throws std::runtime_error if the file can't be written
+	 *  @param [in] path - path of the file
+	 *  @param [in] kind - kind of the net
+	 *  @param [in] nbits - \f$m\f$ parameter of the net
+	 *  @param [in] dim - \f$s\f$ parameter of the net
+	 *  @param [in] table - \f$k\f$-major table of \f$m \cdot s\f$ generating numbers
+	 *  @param [in] irrpolys - irreducible polynomials of the net */
+	void     save(std::string             const &path,
+				  NetKind                        kind,
+				  BasicInt                       nbits,
+				  BasicInt                       dim,
+				  GenNumInt               const *table,
+				  std::vector<Polynomial> const &irrpolys);
+
+	/** Maps a file into memory and checks its header. Throws std::runtime_error if the file can't be mapped and
+	 *  std::logic_error if it has a wrong format, version or kind.
+	 *  @param [in] path - path of the file
+	 *  @param [in] kind - expected kind of the net, NetKind::digital_net accepts files of all kinds */
+	Contents load(std::string const &path,
+				  NetKind            kind);
+
+}
+
+
+#endif // #ifndef TMS_NETS_NETFILE_HPP
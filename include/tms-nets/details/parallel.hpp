@@ -0,0 +1,83 @@
+/**
+ * @file    parallel.hpp
+ *
+ * @brief   Contains the thread pool of the library and helpers for running independent tasks on it.
+ */
+#ifndef TMS_NETS_PARALLEL_HPP
+#define TMS_NETS_PARALLEL_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+
+/** @namespace tms::parallel
+ *  @brief Contains the thread pool of the library and helpers for running independent tasks on it */
+namespace tms::parallel
+{
+	
+	/** @class ThreadPool
+	 *  @brief Work-stealing pool of threads.
+	 *
+	 *  Every worker owns a queue of tasks: it takes tasks from the back of its own queue and, when it is empty,
+	 *  steals from the front of the queues of other workers, so there is no lock shared by all threads. Tasks
+	 *  are submitted in batches that are spread over all queues at once. The thread that submits a batch executes
+	 *  tasks as well until the batch is finished, hence tasks may submit nested batches without deadlocks.
+	 *
+	 *  All parallel algorithms of the library share the pool returned by ThreadPool::global. */
+	class ThreadPool
+	{
+	public:
+		
+		using Task = std::function<void (void)>;
+		
+		/** Creates the pool and starts its workers.
+		 *  @param [in] threads - amount of threads executing tasks including the submitting one, 0 stands for
+		 *                        all hardware threads */
+		explicit ThreadPool(unsigned int threads = 0);
+		
+		ThreadPool(ThreadPool const &) = delete;
+		ThreadPool& operator =(ThreadPool const &) = delete;
+		
+		/// Waits for the workers to finish
+		~ThreadPool(void);
+		
+		/// Returns the amount of threads executing tasks: the workers and the submitting thread
+		unsigned int size(void) const;
+		
+		/** Submits a batch of tasks and waits until all of them are executed. If some of the tasks throw,
+		 *  the first exception is rethrown after the whole batch is finished.
+		 *  @param [in] tasks - tasks to execute */
+		void         run(std::vector<Task> tasks);
+		
+		/// Returns the pool shared by the whole library, it is created on the first call
+		static ThreadPool& global(void);
+		
+		
+	private:
+		
+		struct State;
+		
+		std::unique_ptr<State> m_state;
+	};
+	
+	
+	/** Returns the amount of threads to use for the requested amount.
+	 *  @param [in] threads - requested amount of threads, 0 stands for all hardware threads */
+	unsigned int concurrency(unsigned int threads = 0);
+	
+	/** Calls task(index) for every index from \f$[0, count)\f$ on the global thread pool and waits for all of them.
+	 *  Indices are handed out dynamically, so tasks may take different time. If a task throws, the thread
+	 *  that executed it takes no more indices and the first exception is rethrown after the others finish.
+	 *  @param [in] count - amount of tasks
+	 *  @param [in] task - function to call, must be safe to call concurrently
+	 *  @param [in] threads - highest amount of threads to use, 0 stands for all threads of the pool */
+	void         for_each_index(std::size_t                              count,
+								std::function<void (std::size_t)> const &task,
+								unsigned int                             threads = 0);
+	
+}
+
+
+#endif // #ifndef TMS_NETS_PARALLEL_HPP
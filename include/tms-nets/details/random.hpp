@@ -0,0 +1,42 @@
+/**
+ * @file    random.hpp
+ *
+ * @brief   Contains a counter-based generator of pseudorandom words.
+ */
+#ifndef TMS_NETS_RANDOM_HPP
+#define TMS_NETS_RANDOM_HPP
+
+#include <cstdint>
+
+
+/** @namespace tms::random
+ *  @brief Contains a counter-based generator of pseudorandom words.
+ *
+ *  Words are computed from a key and a counter without any state, so randomizations with different counters
+ *  can be created in any order and on any thread, and they are reproduced exactly by the same key. */
+namespace tms::random
+{
+
+	/** Returns the finalizer of SplitMix64 applied to a word, a bijection that mixes all its bits
+	 *  @param [in] word - word to mix */
+	inline uint64_t
+	mix(uint64_t word)
+	{
+		word = (word ^ (word >> 30))*0xBF58476D1CE4E5B9ULL;
+		word = (word ^ (word >> 27))*0x94D049BB133111EBULL;
+		return word ^ (word >> 31);
+	}
+
+	/** Returns the counter-th output of SplitMix64 started from the state derived from the key
+	 *  @param [in] key - key of the sequence of words
+	 *  @param [in] counter - number of the word in the sequence */
+	inline uint64_t
+	counter_word(uint64_t key, uint64_t counter)
+	{
+		return mix(mix(key) + (counter + 1)*0x9E3779B97F4A7C15ULL);
+	}
+
+}
+
+
+#endif // #ifndef TMS_NETS_RANDOM_HPP
@@ -13,6 +13,21 @@ namespace tms::recseq
 	
 	void fill_vector_recursively(std::vector<BasicInt> &container, uintmax_t init_values, Polynomial const &char_poly);
 	
+	/** Computes the first terms of a linear recurring sequence over GF(2) packed into words: the n-th term is the
+	 *  (n mod 64)-th bit of words[n/64]. Terms are computed with the masked parity of the previous deg terms and,
+	 *  once 64*deg terms are known, a whole word at once using the recurrence with \f$c(x)^{64} = c(x^{64})\f$.
+	 *  @param [out] words - resized to hold count terms, bits after the last term are zero
+	 *  @param [in] count - amount of terms
+	 *  @param [in] init_values - packed first deg terms, the terms after the 64-th one are zero
+	 *  @param [in] char_poly - characteristic polynomial of positive degree deg */
+	void fill_words_recursively(std::vector<uint64_t> &words, CountInt count, uintmax_t init_values, Polynomial const &char_poly);
+	
+	/** Returns packed terms from pos to pos + count - 1 of a sequence packed by fill_words_recursively
+	 *  @param [in] words - packed terms, the ones beyond words are considered zero
+	 *  @param [in] pos - number of the first term
+	 *  @param [in] count - amount of terms, not greater than 64 */
+	uint64_t extract_terms(std::vector<uint64_t> const &words, CountInt pos, BasicInt count);
+	
 	uintmax_t  initial_poly_to_initial_values(Polynomial const &init_poly, Polynomial const &char_poly);
 	
 	Polynomial initial_values_to_initial_poly(uintmax_t init_values, Polynomial const &char_poly);
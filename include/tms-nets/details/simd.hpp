@@ -0,0 +1,59 @@
+/**
+ * @file    simd.hpp
+ *
+ * @brief   Contains vectorized kernels of point generation selected at runtime.
+ */
+#ifndef TMS_NETS_SIMD_HPP
+#define TMS_NETS_SIMD_HPP
+
+#include "common.hpp"
+
+#include <cstddef>
+
+
+/** @namespace tms::simd
+ *  @brief Contains vectorized kernels of point generation.
+ *
+ *  Each kernel has a scalar fallback and SSE2, AVX2 and AVX-512 versions (x86 only). The fastest version
+ *  supported by the processor is chosen through CPUID on the first call. All versions give bitwise
+ *  identical results. */
+namespace tms::simd
+{
+	
+	/** Computes \f$dst_i = src_i \oplus row_i\f$ for all \f$i < count\f$ (dst may coincide with src).
+	 *  @param [out] dst - destination array
+	 *  @param [in] src - first operand
+	 *  @param [in] row - second operand
+	 *  @param [in] count - length of the arrays */
+	void         xor_rows     (GenNumInt *dst, GenNumInt const *src, GenNumInt const *row, std::size_t count);
+	
+	/** Computes \f$out_i = src_i \cdot scale\f$ for all \f$i < count\f$ with correctly rounded integer conversion.
+	 *  @param [out] out - destination array
+	 *  @param [in] src - integers to convert
+	 *  @param [in] count - length of the arrays
+	 *  @param [in] scale - multiplier, normally \f$2^{-m}\f$ */
+	void         int_to_double(double *out, GenNumInt const *src, std::size_t count, double scale);
+	
+	/** Computes \f$products_i = products_i \cdot \min(row_i, value)\f$ for all \f$i < count\f$.
+	 *  @param [in,out] products - array of products
+	 *  @param [in] row - array of factors to compare with the value
+	 *  @param [in] value - the largest factor
+	 *  @param [in] count - length of the arrays */
+	void         multiply_by_min(double *products, double const *row, double value, std::size_t count);
+	
+	/** Computes the product of two polynomials over \f$\mathbb{F}_2\f$ packed into 64-bit words (bit \f$n\f$ of the
+	 *  word \f$w\f$ is the coefficient of \f$x^{64w + n}\f$). Uses PCLMULQDQ when it is available.
+	 *  @param [out] out - array of a_count + b_count words for the product, must not overlap with the operands
+	 *  @param [in] a - words of the first polynomial
+	 *  @param [in] a_count - amount of words of the first polynomial
+	 *  @param [in] b - words of the second polynomial
+	 *  @param [in] b_count - amount of words of the second polynomial */
+	void         clmul        (uint64_t *out, uint64_t const *a, std::size_t a_count, uint64_t const *b, std::size_t b_count);
+	
+	/// Returns the name of the instruction set used by the kernels: "avx512", "avx2", "sse2" or "scalar"
+	char const * instruction_set(void);
+	
+}
+
+
+#endif // #ifndef TMS_NETS_SIMD_HPP
@@ -2,15 +2,53 @@
 #define TMS_NETS_DIGITAL_NET_HPP
 
 #include "details/gf2poly.hpp"
+#include "details/bitops.hpp"
+#include "details/parallel.hpp"
+#include "details/netfile.hpp"
 
 #include <vector>
 #include <cmath>		//for pow function
-#include <algorithm>	//for std::max_element function (is already included in "irrpoly/gfpoly.hpp")
-#include <functional>	//for unified for_each_point* methods (is already included in "irrpoly/gfpoly.hpp")
+#include <algorithm>	//for std::max_element function
+#include <functional>	//for unified for_each_point* methods
+#include <memory>		//for the shared table of generating numbers
+#include <string>		//for paths of saved nets
+#include <type_traits>	//for selection of the conversion to floating types
 
 
 namespace tms
 {
+	/** Memory layout of a block of points filled by DigitalNet::generate_block */
+	enum class Layout
+	{
+		/// Coordinates of each point are adjacent: \f$out[n \cdot s + i]\f$ (AoS)
+		point_major,
+		/// Same coordinates of consecutive points are adjacent: \f$out[i \cdot amount + n]\f$ (SoA)
+		dimension_major
+	};
+	
+	
+	/** Randomization of a digital net applied by DigitalNet::randomize */
+	enum class Randomization
+	{
+		/// Every coordinate of every point is XORed with the same random digits of its dimension
+		digital_shift,
+		/// Every generating matrix is multiplied from the left by a random unit lower triangular matrix
+		matrix_scrambling,
+		/// Matrix scrambling followed by a digital shift
+		scrambling_and_shift
+	};
+	
+	
+	/** Section of consecutive points of a net */
+	struct PointRange
+	{
+		/// Number of the first point of the section
+		CountInt pos;
+		/// Amount of points in the section
+		CountInt amount;
+	};
+	
+	
 	/** Represents digital \f$(t, m, s)\f$-net over \f$\mathbb{F}_2\f$ */
 	class DigitalNet
 	{
@@ -30,6 +68,11 @@ namespace tms
 		/// Creates digital net with given generating matrices
 		DigitalNet(std::vector<GenMat> const &generating_matrices);
 		
+		/** Creates digital net saved into a file by save. The file is mapped into memory and its generating numbers
+		 *  are used in place, so construction takes constant time. Nets of all kinds can be loaded.
+		 *  @param [in] path - path of the file */
+		explicit DigitalNet(std::string const &path);
+		
 		virtual ~DigitalNet(void);
 		
 		/// Returns \f$m\f$ parameter of the net
@@ -76,10 +119,113 @@ namespace tms
 									   CountInt                                         amount,
 									   CountInt                                         pos = 0) const;
 		
+		/** Sequentially generates a section of reordered net points and applies the handler to each pair:
+		 *  (point, point's number). Accepts any callable, so the handler can be inlined into the generation loop.
+		 *  The point is passed by reference to a storage that is reused between calls: it is valid only
+		 *  during the call and should be copied if needed later.
+		 *  Coordinates are computed directly in the requested floating type, e.g. for_each_point<double>(...).
+		 *  @tparam RealType - type of coordinates: float, double or long double
+		 *  @param handler - callable object to apply
+		 *  @param amount - amount of points in the section of the net
+		 *  @param pos - number of the first point in the section of the net */
+		template <typename RealType = Real, typename Handler>
+		void        for_each_point    (Handler  &&handler,
+									   CountInt   amount,
+									   CountInt   pos = 0) const;
+		
+		/** Sequentially generates a section of reordered scaled net points and applies the handler to each pair:
+		 *  (point, point's number). Accepts any callable, so the handler can be inlined into the generation loop.
+		 *  The point is passed by reference to a storage that is reused between calls: it is valid only
+		 *  during the call and should be copied if needed later.
+		 *  @param handler - callable object to apply
+		 *  @param amount - amount of points in the section of the net
+		 *  @param pos - number of the first point in the section of the net */
+		template <typename Handler>
+		void        for_each_int_point(Handler  &&handler,
+									   CountInt   amount,
+									   CountInt   pos = 0) const;
+		
+		/** Generates a section of reordered net points on several threads and applies the handler to each pair:
+		 *  (point, point's number). The section is split with split_range, each part is started directly at
+		 *  its first point and walked with Gray's code, so every point is bitwise identical to the one produced
+		 *  by for_each_point. Points of one part are passed in order, parts are processed concurrently.
+		 *  @tparam RealType - type of coordinates: float, double or long double
+		 *  @param handler - callable object to apply, must be safe to call concurrently
+		 *  @param amount - amount of points in the section of the net
+		 *  @param pos - number of the first point in the section of the net
+		 *  @param threads - amount of threads to use, 0 stands for all hardware threads */
+		template <typename RealType = Real, typename Handler>
+		void        for_each_point_parallel    (Handler      &&handler,
+												CountInt       amount,
+												CountInt       pos = 0,
+												unsigned int   threads = 0) const;
+		
+		/** Generates a section of reordered scaled net points on several threads and applies the handler to each pair:
+		 *  (point, point's number). The section is split with split_range, each part is started directly at
+		 *  its first point and walked with Gray's code. Points of one part are passed in order, parts are processed
+		 *  concurrently.
+		 *  @param handler - callable object to apply, must be safe to call concurrently
+		 *  @param amount - amount of points in the section of the net
+		 *  @param pos - number of the first point in the section of the net
+		 *  @param threads - amount of threads to use, 0 stands for all hardware threads */
+		template <typename Handler>
+		void        for_each_int_point_parallel(Handler      &&handler,
+												CountInt       amount,
+												CountInt       pos = 0,
+												unsigned int   threads = 0) const;
+		
+		/** Splits a section of points into independent parts of nearly equal sizes. All inner boundaries
+		 *  are multiples of range_alignment, so each part can be generated separately from its first point.
+		 *  @param amount - amount of points in the section of the net
+		 *  @param pos - number of the first point in the section of the net
+		 *  @param parts - desired amount of parts (less parts are returned for short sections) */
+		static std::vector<PointRange> split_range(CountInt amount,
+												   CountInt pos,
+												   CountInt parts);
+		
+		/// Alignment of inner boundaries of parts returned by split_range
+		static CountInt const range_alignment = 64;
+		
+		/** Sequentially generates a section of reordered net points into a caller-owned buffer.
+		 *  No memory is allocated per point.
+		 *  @tparam RealType - type of coordinates: float, double or long double
+		 *  @param [in] pos - number of the first point in the section of the net
+		 *  @param [in] amount - amount of points in the section of the net
+		 *  @param [out] out - buffer of at least amount*s() elements
+		 *  @param [in] layout - order in which coordinates are stored into the buffer */
+		template <typename RealType>
+		void        generate_block    (CountInt  pos,
+									   CountInt  amount,
+									   RealType *out,
+									   Layout    layout = Layout::point_major) const;
+		
+		/** Randomizes the net. Matrix scrambling replaces the table of generating numbers by a new one (copies of
+		 *  the net keep sharing the old table), a digital shift becomes the starting point of Gray's code, so
+		 *  generation of points costs the same as before. Both keep the \f$t\f$ parameter of the net, and every
+		 *  point of a net randomized by both is uniformly distributed over the grid of \f$2^{ms}\f$ cells.
+		 *  Random digits are computed from the seed, the counter, the dimension and the digit by
+		 *  tms::random::counter_word without any shared state, so copies of a net can be randomized with different
+		 *  counters concurrently and each randomization is reproduced exactly. Randomizing a randomized net again
+		 *  composes both randomizations. Note that Sobol::inversed_generating_numbers describes the original net.
+		 *  @param [in] seed - seed of randomizations
+		 *  @param [in] counter - number of the randomization, different counters give independent randomizations
+		 *  @param [in] kind - randomization to apply */
+		void randomize(uint64_t      seed,
+					   uint64_t      counter,
+					   Randomization kind = Randomization::scrambling_and_shift);
+		
+		/// Returns true if points of the net are digitally shifted
+		bool is_shifted(void) const;
+		
 		/** Casts scaled integer point to a point by multiplying it by \f$2^{-m}\f$
 		 *  @param int_point - point to cast */
 		Point cast_int_point_to_real(IntPoint const &int_point) const;
 		
+		/** Saves the net into a binary file (see tms::netfile) that can be loaded by the constructor from a path.
+		 *  The format keeps generating numbers only, so digitally shifted nets can't be saved.
+		 *  @param [in] path - path of the file */
+		virtual void save(std::string const &path) const;
+		
 		
 	protected:
 		
@@ -89,8 +235,14 @@ namespace tms
 		BasicInt m_dim;
 		/// Coefficient equal to \f$2^{-m}\f$
 		Real     m_recip;
-		/// Vector of a generating numbers of the digital net
+		/// Vector of a generating numbers of the digital net, filled during construction (empty for loaded nets)
 		std::vector<GenNum> m_generating_numbers;
+		/// Generating numbers stored \f$k\f$-major: element \f$k \cdot s + i\f$ is the \f$k\f$-th generating number
+		/// of the \f$i\f$-th dimension, so one step of Gray's code reads a single contiguous row.
+		/// The table is immutable and shared by copies of the net, it may point into a mapped file.
+		std::shared_ptr<GenNumInt const> m_transposed_numbers;
+		/// Digital shift of scaled points, the starting point of Gray's code (empty if the net isn't shifted)
+		IntPoint m_shift;
 		
 		/**
 		 */
@@ -98,6 +250,29 @@ namespace tms
 				   BasicInt                   dim,
 				   std::vector<GenNum> const &generating_numbers);
 		
+		/** Creates digital net from a loaded file
+		 *  @param [in] contents - contents of the file */
+		DigitalNet(netfile::Contents const &contents);
+		
+		/** Saves the net with the additional information of the subclass
+		 *  @param [in] path - path of the file
+		 *  @param [in] kind - kind of the net
+		 *  @param [in] irrpolys - irreducible polynomials of the net */
+		void  save(std::string             const &path,
+				   netfile::NetKind               kind,
+				   std::vector<Polynomial> const &irrpolys) const;
+		
+		/** Rebuilds the \f$k\f$-major table of generating numbers. Must be called whenever m_generating_numbers change. */
+		void  update_transposed_numbers(void);
+		
+		/** Stores scaled point multiplied by \f$2^{-m}\f$ into the array of s() coordinates.
+		 *  For float and double the conversion is done with bit manipulations only when it is exact.
+		 *  @param [out] point - storage array
+		 *  @param [in] int_point - scaled point */
+		template <typename RealType>
+		void  store_real_point    (RealType       *point,
+								   IntPoint const &int_point) const;
+		
 		/** Stores into the integer vector scaled (t,m,s)-net point with certain number, enumerated according to Gray's code.
 		 *  @param [out] point - storage vector
 		 *  @param [in] pos - generated scaled (t,m,s)-net point number */
@@ -128,13 +303,120 @@ namespace tms
 	DigitalNet::s(void) const
 	{ return m_dim; }
 	
-	inline GenNum
-	DigitalNet::generating_numbers(BasicInt dim) const
-	{ return m_generating_numbers[dim]; }
+	inline bool
+	DigitalNet::is_shifted(void) const
+	{ return !m_shift.empty(); }
 	
 	inline GenMat
 	DigitalNet::generating_matrix(BasicInt dim) const
-	{ return GenMat(m_generating_numbers[dim]); }
+	{ return GenMat(generating_numbers(dim)); }
+	
+	template <typename RealType>
+	inline void
+	DigitalNet::store_real_point(RealType       *point,
+								 IntPoint const &int_point) const
+	{
+		if constexpr ( std::is_same_v<RealType, double> )
+		{
+			if ( m_nbits <= bitops::exact_double_bits )
+			{
+				for (BasicInt i = 0; i < m_dim; ++i)
+				{
+					point[i] = bitops::to_unit_double(int_point[i], m_nbits);
+				}
+				return;
+			}
+		}
+		else if constexpr ( std::is_same_v<RealType, float> )
+		{
+			if ( m_nbits <= bitops::exact_float_bits )
+			{
+				for (BasicInt i = 0; i < m_dim; ++i)
+				{
+					point[i] = bitops::to_unit_float(int_point[i], m_nbits);
+				}
+				return;
+			}
+		}
+		RealType const recip = static_cast<RealType>(m_recip);
+		for (BasicInt i = 0; i < m_dim; ++i)
+		{
+			point[i] = static_cast<RealType>(int_point[i])*recip;
+		}
+	}
+	
+	template <typename RealType, typename Handler>
+	inline void
+	DigitalNet::for_each_point(Handler  &&handler,
+							   CountInt   amount,
+							   CountInt   pos) const
+	{
+		if ( amount != 0 )
+		{
+			IntPoint                     curr_int(m_dim);
+			std::vector<RealType>        curr(m_dim);
+			std::vector<RealType> const &curr_view = curr;
+			store_int_point(curr_int, pos);
+			for ( ; ; )
+			{
+				store_real_point(curr.data(), curr_int);
+				handler(curr_view, pos);
+				if ( --amount == 0 )
+				{
+					break;
+				}
+				++pos;
+				store_next_int_point(curr_int, pos, curr_int);
+			}
+		}
+	}
+	
+	template <typename RealType, typename Handler>
+	inline void
+	DigitalNet::for_each_point_parallel(Handler      &&handler,
+										CountInt       amount,
+										CountInt       pos,
+										unsigned int   threads) const
+	{
+		std::vector<PointRange> const ranges = split_range(amount, pos, parallel::concurrency(threads));
+		parallel::for_each_index(ranges.size(), [&](std::size_t range_i) {
+			for_each_point<RealType>(handler, ranges[range_i].amount, ranges[range_i].pos);
+		}, threads);
+	}
+	
+	template <typename Handler>
+	inline void
+	DigitalNet::for_each_int_point_parallel(Handler      &&handler,
+											CountInt       amount,
+											CountInt       pos,
+											unsigned int   threads) const
+	{
+		std::vector<PointRange> const ranges = split_range(amount, pos, parallel::concurrency(threads));
+		parallel::for_each_index(ranges.size(), [&](std::size_t range_i) {
+			for_each_int_point(handler, ranges[range_i].amount, ranges[range_i].pos);
+		}, threads);
+	}
+	
+	template <typename Handler>
+	inline void
+	DigitalNet::for_each_int_point(Handler  &&handler,
+								   CountInt   amount,
+								   CountInt   pos) const
+	{
+		if ( amount != 0 )
+		{
+			IntPoint        curr_int(m_dim);
+			IntPoint const &curr_view = curr_int;
+			store_int_point(curr_int, pos);
+			handler(curr_view, pos);
+			while ( --amount )
+			{
+				++pos;
+				store_next_int_point(curr_int, pos, curr_int);
+				handler(curr_view, pos);
+			}
+		}
+	}
 	
 }
 
@@ -28,7 +28,8 @@ namespace tms
 		/** Constructs the generator of (t,m,s)-net with specified m, s, and with induced least possible t.
 		 *  @param [in] nbits - m parameter of the net
 		 *  @param [in] dim - s parameter of the net
-		 *  @param [in] in_parallel - flag, defining the method that will be used to generate irreducible polynomials */
+		 *  @param [in] in_parallel - flag, defining whether irreducible polynomials and generating matrices of different
+		 *                            dimensions are generated on the thread pool (the net is the same in both cases) */
 		Niederreiter(BasicInt nbits,
 		             BasicInt dim,
 		             bool     in_parallel = false);
@@ -61,8 +62,17 @@ namespace tms
 		Niederreiter(BasicInt                                               nbits,
 		             std::initializer_list< std::vector<uintmax_t> > const &irrpolys_coeffs);
 		
+		/** Constructs the generator of (t,m,s)-net saved into a file by save. The file is mapped into memory and its
+		 *  generating numbers are used in place, only the irreducible polynomials are read.
+		 *  @param [in] path - path of the file saved from a Niederreiter net */
+		explicit Niederreiter(std::string const &path);
+		
 		~Niederreiter(void);
 		
+		/** Saves the net with its irreducible polynomials into a binary file
+		 *  @param [in] path - path of the file */
+		void save(std::string const &path) const override;
+		
 		/// Retutns t-value of a corresponding digital (t, s)-sequence
 		BasicInt t_estimate(void) const;
 	
@@ -81,12 +91,23 @@ namespace tms
 					 void           (Niederreiter::*ptr_check)(void const *),
 					 void                    const *ptr_arg);
 		
+		/** Constructs the generator of (t,m,s)-net from a loaded file
+		 *  @param [in] contents - contents of the file */
+		Niederreiter(netfile::Contents const &contents);
+		
 		void check_init1(void const *ptr_arg);
 		void check_init2(void const *ptr_arg);
 		void check_init3(void const *ptr_arg);
 		
-		/** Initializes (t,m,s)-net direction numbers.*/
-		virtual void initialize_generating_numbers(void);
+		/** Initializes (t,m,s)-net direction numbers.
+		 *  @param [in] in_parallel - flag, defining whether dimensions are initialized on the thread pool */
+		void         initialize_generating_numbers(bool in_parallel = false);
+		
+		/** Initializes direction numbers of the dimensions from [dim_begin, dim_end). Uses only its own scratch space,
+		 *  so disjoint ranges can be initialized concurrently.
+		 *  @param [in] dim_begin - first dimension to initialize
+		 *  @param [in] dim_end - dimension after the last one to initialize */
+		virtual void initialize_dimensions(BasicInt dim_begin, BasicInt dim_end);
 	};
 	
 };// namespace tms
@@ -0,0 +1,129 @@
+/**
+ * @file    integrator.hpp
+ *
+ * @brief   Contains randomized Quasi Monte Carlo integration over digital nets.
+ */
+#ifndef TMS_NETS_INTEGRATOR_HPP
+#define TMS_NETS_INTEGRATOR_HPP
+
+#include "../digital_net.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+
+
+
+
+/**
+ * @namespace tms::qmc
+ *
+ * @brief Contains randomized Quasi Monte Carlo integration over digital nets.
+ *
+ * A digital net gives a deterministic estimate of an integral over the unit cube without any estimate
+ * of its error. Independent randomizations of the net give independent unbiased estimates, so the error
+ * is estimated by their spread like in Monte Carlo methods, while each of them keeps the precision of
+ * Quasi Monte Carlo.
+ */
+namespace tms::qmc
+{
+
+
+
+	/**
+	 * Integrand evaluated on a block of points
+	 *
+	 * It is called as <tt>integrand(points, count, values)</tt>, where the \f$k\f$-th coordinate of the
+	 * \f$n\f$-th point is <tt>points[n*s + k]</tt> and <tt>values[n]</tt> must be set to the value of the
+	 * integrand at the \f$n\f$-th point for every \f$n\f$ less than \c count.
+	 */
+	using Integrand = std::function<void (double const *points, std::size_t count, double *values)>;
+
+	/// Estimate of an integral by independent randomizations of a digital net
+	struct Estimate
+	{
+		/// Mean of estimates of all replicates
+		Real              mean;
+		/// Standard error of the mean
+		Real              standard_error;
+		/// Lower bound of the confidence interval
+		Real              lower;
+		/// Upper bound of the confidence interval
+		Real              upper;
+		/// Estimates of the integral by each replicate
+		std::vector<Real> replicates;
+	};
+
+
+
+	/**
+	 * Randomized Quasi Monte Carlo integrator
+	 *
+	 * Integrates functions over the unit cube \f$[0, 1)^s\f$ by \f$R\f$ independent replicates of a digital
+	 * net. Every replicate is the net randomized by DigitalNet::randomize with a matrix scrambling and
+	 * a digital shift, and the digits of its points below \f$2^{-m}\f$ are filled with random digits down to
+	 * the precision of \c double. Points of a replicate are uniformly distributed, so its estimate is unbiased,
+	 * and keep the equidistribution of the net. Randomizations are computed from the seed and the number of
+	 * a replicate by \ref tms::random::counter_word, so estimates are reproduced exactly by the same seed.
+	 */
+	class Integrator
+	{
+	public:
+
+		/**
+		 * Creates the integrator
+		 *
+		 * @param   net             A digital net.
+		 * @param   replicates      Amount \f$R\f$ of independent replicates, at least \f$2\f$.
+		 * @param   seed            Seed of randomizations.
+		 * @param   block_size      Amount of points passed to the integrand at once.
+		 *
+		 * @throws  invalid_argument    If there are less than \f$2\f$ replicates or \c block_size is zero.
+		 */
+		Integrator(DigitalNet const &net,
+				   BasicInt          replicates,
+				   uint64_t          seed       = 0,
+				   std::size_t       block_size = 1024);
+
+		/**
+		 * Estimates the integral of a function over the unit cube
+		 *
+		 * Blocks of points of all replicates are evaluated in parallel on the thread pool of the library.
+		 * Values of a block are summed pairwise, and sums of blocks of a replicate are summed pairwise in
+		 * a fixed order, so the result doesn't depend on the amount of threads.
+		 *
+		 * @param   integrand       Integrand, it must be safe to call concurrently.
+		 * @param   confidence      Confidence level of the interval from \f$(0, 1)\f$.
+		 *
+		 * @returns Mean of estimates of replicates, its standard error and the confidence interval based on
+		 * Student's \f$t\f$-distribution with \f$R - 1\f$ degrees of freedom.
+		 *
+		 * @throws  invalid_argument    If \c confidence is not in \f$(0, 1)\f$.
+		 */
+		Estimate integrate(Integrand const &integrand, Real confidence = 0.95) const;
+
+		/// Returns the amount of replicates
+		BasicInt replicates(void) const;
+
+		/// Returns the seed of randomizations
+		uint64_t seed(void) const;
+
+
+	private:
+
+		DigitalNet  m_net;
+		BasicInt    m_replicates;
+		uint64_t    m_seed;
+		std::size_t m_block_size;
+	};
+
+
+
+}; // namespace tms::qmc
+
+
+
+
+
+#endif // #ifndef TMS_NETS_INTEGRATOR_HPP
@@ -41,6 +41,15 @@ namespace tms
 		Sobol(BasicInt                                               nbits,
 			  std::initializer_list< std::vector<uintmax_t> > const &irrpolys_coeffs);
 		
+		/** Constructs the generator of (t,m,s)-net saved into a file by save. The file is mapped into memory and its
+		 *  generating numbers are used in place, only the irreducible polynomials are read.
+		 *  @param [in] path - path of the file saved from a Sobol net */
+		explicit Sobol(std::string const &path);
+		
+		/** Saves the net with its irreducible polynomials into a binary file
+		 *  @param [in] path - path of the file */
+		void save(std::string const &path) const override;
+		
 		GenNum inversed_generating_numbers(BasicInt dim) const;
 		
 		GenMat inversed_generating_matrix(BasicInt dim) const;
@@ -48,7 +57,7 @@ namespace tms
 		
 	protected:
 		
-		void initialize_generating_numbers(void) override;
+		void initialize_dimensions(BasicInt dim_begin, BasicInt dim_end) override;
 		
 	};
 	
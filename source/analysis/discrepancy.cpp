@@ -0,0 +1,331 @@
+/**
+ * @file    discrepancy.cpp
+ *
+ * @brief   Contains functions for calculations of discrepancies.
+ */
+#include "../../include/tms-nets/analysis/analysis.hpp"
+
+#include "../../include/tms-nets/details/parallel.hpp"
+#include "../../include/tms-nets/details/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+
+
+
+
+namespace
+{
+
+	/// Measured ratio of the time per point and per term of \f$(\log N)^s/s!\f$ in divide and conquer to the time per
+	/// pair of points and per coordinate in Warnock's kernel
+	double const        sc_divide_cost_ratio  = 55;
+
+	/// Highest amount of points in a part for which sums of divide and conquer are found directly
+	std::size_t const   sc_direct_max_size    = 32;
+
+	/// Lowest amount of points in a part for which subproblems of divide and conquer are solved on several threads
+	std::size_t const   sc_parallel_min_size  = 1 << 14;
+
+	/// Amount of points in tiles of Warnock's kernel, coordinates of a tile are kept in the cache of a core
+	std::size_t const   sc_tile_size          = 256;
+
+
+	/**
+	 * Returns coordinates \f$y = 1 - x\f$ of net points stored dimension by dimension: the \f$k\f$-th
+	 * coordinate of the \f$i\f$-th point is at \f$k N + i\f$
+	 */
+	std::vector<double> complement_coordinates(tms::DigitalNet const &net)
+	{
+		tms::CountInt const     count = 1ULL << net.m();
+		tms::BasicInt const     s     = net.s();
+		int const               shift = -static_cast<int>(net.m());
+		std::vector<double>     y(static_cast<std::size_t>(count)*s);
+		net.for_each_int_point_parallel([&](tms::IntPoint const &point, tms::CountInt pos) {
+			for (tms::BasicInt k = 0; k < s; ++k)
+				y[k*count + pos] = std::ldexp(static_cast<double>(count - point[k]), shift);
+		}, count);
+		return y;
+	}
+
+	/// Returns \f$\sum_i \prod_k (1 - x_{ik}^2)\f$ for coordinates \f$y = 1 - x\f$
+	tms::Real square_products_sum(std::vector<double> const &y, tms::CountInt count, tms::BasicInt s)
+	{
+		tms::Real sum = 0;
+		for (tms::CountInt i = 0; i < count; ++i)
+		{
+			double product = 1;
+			for (tms::BasicInt k = 0; k < s; ++k)
+				product *= y[k*count + i]*(2.0 - y[k*count + i]);
+			sum += product;
+		}
+		return sum;
+	}
+
+
+	/// A point in a part of divide and conquer: its number, its weight and its side in bichromatic sums
+	struct Item
+	{
+		tms::CountInt point;
+		double        weight;
+		bool          first;
+	};
+
+	/**
+	 * Sums over pairs of points \f$\sum_{i, j} w_i w_j \prod_{k < d} \min(y_{ik}, y_{jk})\f$ by Heinrich's
+	 * divide and conquer. A part is split by the median of its last coordinate \f$d - 1\f$: the minimum of this
+	 * coordinate over a pair of points from different halves is the one of the lower half, so it moves into
+	 * the weight and such pairs are summed over \f$d - 1\f$ coordinates. It takes \f$O(N (\log N)^d)\f$ operations.
+	 */
+	class DividedSum
+	{
+	public:
+
+		DividedSum(std::vector<double> const &y, tms::CountInt count) :
+			m_y(y),
+			m_count(count)
+		{}
+
+		/// Returns the sum over all ordered pairs of items of a part
+		tms::Real monochromatic(Item *begin, Item *end, tms::BasicInt d) const
+		{
+			std::size_t const size = end - begin;
+			if ( d == 0 )
+			{
+				tms::Real weights = 0;
+				for (Item *item = begin; item != end; ++item)
+					weights += item->weight;
+				return weights*weights;
+			}
+			if ( size <= sc_direct_max_size )
+			{
+				tms::Real sum = 0;
+				for (Item *a = begin; a != end; ++a)
+				{
+					sum += a->weight*a->weight*min_product(*a, *a, d);
+					for (Item *b = a + 1; b != end; ++b)
+						sum += 2*a->weight*b->weight*min_product(*a, *b, d);
+				}
+				return sum;
+			}
+			if ( d == 1 )
+			{
+				// every pair is counted at its point with the lower coordinate
+				sort(begin, end, 0);
+				tms::Real sum    = 0;
+				tms::Real higher = 0;
+				for (Item *item = end; item-- != begin;)
+				{
+					sum    += item->weight*coordinate(*item, 0)*(2*higher + item->weight);
+					higher += item->weight;
+				}
+				return sum;
+			}
+
+			Item *middle = split(begin, end, d - 1);
+			std::vector<Item> cross(begin, end);
+			for (std::size_t item_i = 0; item_i < cross.size(); ++item_i)
+			{
+				cross[item_i].first = begin + item_i < middle;
+				if ( cross[item_i].first )
+					cross[item_i].weight *= coordinate(cross[item_i], d - 1);
+			}
+			std::function<tms::Real (void)> const parts[] = {
+				[&](){ return monochromatic(begin, middle, d); },
+				[&](){ return monochromatic(middle, end, d); },
+				[&](){ return 2*bichromatic(cross.data(), cross.data() + cross.size(), d - 1); }};
+			return solve(parts, 3, size);
+		}
+
+		/// Returns the sum over pairs of items of a part such that the first item of a pair is on the first side
+		tms::Real bichromatic(Item *begin, Item *end, tms::BasicInt d) const
+		{
+			std::size_t const size = end - begin;
+			tms::Real first_weights  = 0;
+			tms::Real second_weights = 0;
+			for (Item *item = begin; item != end; ++item)
+				(item->first ? first_weights : second_weights) += item->weight;
+			if ( first_weights == 0 || second_weights == 0 )
+				return 0;
+			if ( d == 0 )
+				return first_weights*second_weights;
+			if ( size <= sc_direct_max_size )
+			{
+				tms::Real sum = 0;
+				for (Item *a = begin; a != end; ++a)
+					if ( a->first )
+						for (Item *b = begin; b != end; ++b)
+							if ( !b->first )
+								sum += a->weight*b->weight*min_product(*a, *b, d);
+				return sum;
+			}
+			if ( d == 1 )
+			{
+				sort(begin, end, 0);
+				tms::Real sum       = 0;
+				tms::Real higher[2] = {0, 0};
+				for (Item *item = end; item-- != begin;)
+				{
+					sum                 += item->weight*coordinate(*item, 0)*higher[!item->first];
+					higher[item->first] += item->weight;
+				}
+				return sum;
+			}
+
+			Item *middle = split(begin, end, d - 1);
+			std::vector<Item> lower_first;
+			std::vector<Item> upper_first;
+			for (Item *item = begin; item != end; ++item)
+			{
+				bool const lower    = item < middle;
+				Item       weighted = *item;
+				if ( lower )
+					weighted.weight *= coordinate(*item, d - 1);
+				(lower == item->first ? lower_first : upper_first).push_back(weighted);
+			}
+			std::function<tms::Real (void)> const parts[] = {
+				[&](){ return bichromatic(begin, middle, d); },
+				[&](){ return bichromatic(middle, end, d); },
+				[&](){ return bichromatic(lower_first.data(), lower_first.data() + lower_first.size(), d - 1); },
+				[&](){ return bichromatic(upper_first.data(), upper_first.data() + upper_first.size(), d - 1); }};
+			return solve(parts, 4, size);
+		}
+
+
+	private:
+
+		double coordinate(Item const &item, tms::BasicInt k) const
+		{
+			return m_y[k*m_count + item.point];
+		}
+
+		double min_product(Item const &a, Item const &b, tms::BasicInt d) const
+		{
+			double product = 1;
+			for (tms::BasicInt k = 0; k < d; ++k)
+				product *= std::min(coordinate(a, k), coordinate(b, k));
+			return product;
+		}
+
+		void sort(Item *begin, Item *end, tms::BasicInt k) const
+		{
+			std::sort(begin, end, [&](Item const &a, Item const &b){ return coordinate(a, k) < coordinate(b, k); });
+		}
+
+		/// Moves the lower half of items by the k-th coordinate before the upper one and returns the boundary
+		Item *split(Item *begin, Item *end, tms::BasicInt k) const
+		{
+			Item *middle = begin + (end - begin)/2;
+			std::nth_element(begin, middle, end, [&](Item const &a, Item const &b){ return coordinate(a, k) < coordinate(b, k); });
+			return middle;
+		}
+
+		/// Sums results of independent parts in a fixed order, large parts are solved on several threads
+		static tms::Real solve(std::function<tms::Real (void)> const *parts, std::size_t count, std::size_t size)
+		{
+			std::vector<tms::Real> results(count);
+			if ( size >= sc_parallel_min_size )
+				tms::parallel::for_each_index(count, [&](std::size_t part_i){ results[part_i] = parts[part_i](); });
+			else
+				for (std::size_t part_i = 0; part_i < count; ++part_i)
+					results[part_i] = parts[part_i]();
+			tms::Real sum = 0;
+			for (tms::Real result : results)
+				sum += result;
+			return sum;
+		}
+
+		std::vector<double> const &m_y;
+		tms::CountInt              m_count;
+	};
+
+	/**
+	 * Returns \f$\sum_{i, j} \prod_k \min(y_{ik}, y_{jk})\f$ by Warnock's formula directly. Points are split into tiles,
+	 * the sums over pairs of tiles are found by a row of tiles per task, and products of a point with a whole tile
+	 * are accumulated at once. Rows of tiles are summed in a fixed order.
+	 */
+	tms::Real tiled_pair_sum(std::vector<double> const &y, tms::CountInt count, tms::BasicInt s)
+	{
+		std::size_t const      tiles_count = (count + sc_tile_size - 1)/sc_tile_size;
+		std::vector<tms::Real> row_sums(tiles_count, 0);
+		tms::parallel::for_each_index(tiles_count, [&](std::size_t row_i) {
+			std::vector<double> products(sc_tile_size);
+			std::size_t const   row_end = std::min<std::size_t>(count, (row_i + 1)*sc_tile_size);
+			for (std::size_t tile_i = row_i; tile_i < tiles_count; ++tile_i)
+			{
+				std::size_t const tile_begin = tile_i*sc_tile_size;
+				std::size_t const tile_size  = std::min<std::size_t>(count, tile_begin + sc_tile_size) - tile_begin;
+				tms::Real         tile_sum   = 0;
+				for (std::size_t i = row_i*sc_tile_size; i < row_end; ++i)
+				{
+					std::fill(products.begin(), products.begin() + tile_size, 1.0);
+					for (tms::BasicInt k = 0; k < s; ++k)
+						tms::simd::multiply_by_min(products.data(), y.data() + k*count + tile_begin, y[k*count + i], tile_size);
+					double point_sum = 0;
+					for (std::size_t j = 0; j < tile_size; ++j)
+						point_sum += products[j];
+					tile_sum += point_sum;
+				}
+				// pairs of different tiles are met once
+				row_sums[row_i] += tile_i == row_i ? tile_sum : 2*tile_sum;
+			}
+		});
+		tms::Real sum = 0;
+		for (tms::Real row_sum : row_sums)
+			sum += row_sum;
+		return sum;
+	}
+
+	/**
+	 * Returns whether divide and conquer is faster than Warnock's kernel: it takes about \f$N \frac{m^s}{s!}\f$
+	 * operations against \f$N^2 (s + 2)\f$ ones, where two extra coordinates stand for the summation of a tile
+	 */
+	bool divide_is_faster(tms::BasicInt m, tms::BasicInt s)
+	{
+		double divide_cost = sc_divide_cost_ratio;
+		for (tms::BasicInt k = 1; k <= s; ++k)
+			divide_cost *= static_cast<double>(m)/k;
+		return divide_cost < std::ldexp(static_cast<double>(s + 2), static_cast<int>(m));
+	}
+
+	/// Returns the squared \f$L_2\f$-star discrepancy of points with coordinates \f$y = 1 - x\f$ by Warnock's formula
+	tms::Real warnock_formula(std::vector<double> const &y, tms::CountInt count, tms::BasicInt s, tms::Real pair_sum)
+	{
+		tms::Real const n = static_cast<tms::Real>(count);
+		return std::pow(tms::Real(3), -static_cast<tms::Real>(s))
+			 - std::pow(tms::Real(2), 1 - static_cast<tms::Real>(s))*square_products_sum(y, count, s)/n
+			 + pair_sum/(n*n);
+	}
+
+}
+
+
+
+
+
+tms::Real tms::analysis::l2_star_discrepancy(tms::DigitalNet const &net)
+{
+	CountInt const count = 1ULL << net.m();
+	BasicInt const s     = net.s();
+
+	std::vector<double> const y = complement_coordinates(net);
+	Real                      pair_sum;
+	if ( divide_is_faster(net.m(), s) )
+	{
+		std::vector<Item> items(count);
+		for (CountInt i = 0; i < count; ++i)
+			items[i] = Item{i, 1.0, true};
+		pair_sum = DividedSum(y, count).monochromatic(items.data(), items.data() + count, s);
+	}
+	else
+	{
+		pair_sum = tiled_pair_sum(y, count, s);
+	}
+	Real const squared = warnock_formula(y, count, s, pair_sum);
+
+	// rounding errors may only make tiny values negative
+	return std::sqrt(std::max(squared, Real(0)));
+}
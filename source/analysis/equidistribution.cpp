@@ -0,0 +1,252 @@
+/**
+ * @file    equidistribution.cpp
+ *
+ * @brief   Contains functions for verification of equidistribution of digital nets.
+ */
+#include "../../include/tms-nets/analysis/analysis.hpp"
+
+#include "../../include/tms-nets/details/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+
+
+
+namespace
+{
+
+	/// Index of an elementary interval: the chosen digits of all coordinates written one after another
+	using IntervalIndex = uint32_t;
+
+	/// Amount of points processed at once, blocks of this constant size are vectorized by the compiler
+	std::size_t const sc_block_size = 1024;
+
+	/// Pair of a coordinate and the amount of its digits that define an elementary interval
+	using Part = std::pair<tms::BasicInt, tms::BasicInt>;
+
+
+	/// Returns the amount of compositions of digits into parts or throws if it is too large
+	tms::CountInt compositions_count(tms::BasicInt digits, tms::BasicInt parts)
+	{
+		// binomial coefficient C(digits + parts - 1, digits) computed by rows of Pascal's triangle
+		std::vector<tms::CountInt> row(digits + 1, 1);
+		for (tms::BasicInt part_i = 1; part_i < parts; ++part_i)
+		{
+			for (tms::BasicInt digit_i = 1; digit_i <= digits; ++digit_i)
+			{
+				if ( row[digit_i] > std::numeric_limits<tms::CountInt>::max() - row[digit_i - 1] )
+					throw std::length_error("\nToo many compositions\n");
+				row[digit_i] += row[digit_i - 1];
+			}
+		}
+		return row[digits];
+	}
+
+	/**
+	 * Stores the composition of the given rank in the lexicographic order
+	 * @param [in] rank - number of the composition
+	 * @param [in] digits - sum of parts
+	 * @param [out] composition - parts, the size of the vector is the amount of them
+	 */
+	void unrank_composition(tms::CountInt rank, tms::BasicInt digits, std::vector<tms::BasicInt> &composition)
+	{
+		tms::BasicInt const parts = composition.size();
+		for (tms::BasicInt part_i = 0; part_i + 1 < parts; ++part_i)
+		{
+			tms::BasicInt part = 0;
+			for (;; ++part)
+			{
+				tms::CountInt const following = compositions_count(digits - part, parts - part_i - 1);
+				if ( rank < following )
+					break;
+				rank -= following;
+			}
+			composition[part_i]  = part;
+			digits              -= part;
+		}
+		composition[parts - 1] = digits;
+	}
+
+	/// Moves to the next composition in the lexicographic order, the last part gives a unit to the previous part
+	/// of the last nonzero one
+	void next_composition(std::vector<tms::BasicInt> &composition)
+	{
+		tms::BasicInt last = composition.size() - 1;
+		while ( composition[last] == 0 )
+			--last;
+		tms::BasicInt const rest = composition[last] - 1;
+		composition[last]                   = 0;
+		composition[last - 1]              += 1;
+		composition[composition.size() - 1] = rest;
+	}
+
+	/**
+	 * Counts points in elementary intervals of a composition of digits. Scaled coordinates are cut to their highest
+	 * digits once. The index of a point's interval is accumulated part by part and indices for leading parts are kept,
+	 * so only the parts that differ from the previous composition are recomputed.
+	 */
+	class IntervalCounter
+	{
+	public:
+
+		/**
+		 * @param [in] columns - highest digits of coordinates of points stored dimension by dimension
+		 * @param [in] count - amount of points
+		 * @param [in] stride - distance between dimensions in columns, a multiple of sc_block_size
+		 * @param [in] digits - amount of the highest digits
+		 */
+		IntervalCounter(std::vector<IntervalIndex> const &columns, tms::CountInt count, std::size_t stride, tms::BasicInt digits) :
+			m_columns(columns),
+			m_count(count),
+			m_stride(stride),
+			m_digits(digits),
+			m_counters(tms::CountInt(1) << digits)
+		{}
+
+		/// Counts points in intervals of the composition and returns the counters
+		std::vector<tms::CountInt> const &count(std::vector<tms::BasicInt> const &composition)
+		{
+			std::vector<Part> parts;
+			for (tms::BasicInt k = 0; k < composition.size(); ++k)
+				if ( composition[k] != 0 )
+					parts.emplace_back(k, composition[k]);
+
+			// indices for all parts but the last one are kept for the next compositions
+			std::size_t level = 0;
+			while ( level < m_parts.size() && level + 1 < parts.size() && m_parts[level] == parts[level] )
+				++level;
+			m_parts.resize(level);
+			if ( m_levels.size() + 1 < parts.size() )
+				m_levels.resize(parts.size() - 1, std::vector<IntervalIndex>(m_stride));
+			for ( ; level + 1 < parts.size(); ++level)
+			{
+				for (std::size_t block = 0; block < m_stride; block += sc_block_size)
+					append_part(level, parts[level], block, m_levels[level].data() + block);
+				m_parts.push_back(parts[level]);
+			}
+
+			std::fill(m_counters.begin(), m_counters.end(), 0);
+			IntervalIndex indices[sc_block_size];
+			for (std::size_t block = 0; block < m_count; block += sc_block_size)
+			{
+				append_part(parts.size() - 1, parts.back(), block, indices);
+				std::size_t const block_end = std::min<std::size_t>(m_count - block, sc_block_size);
+				for (std::size_t j = 0; j < block_end; ++j)
+					++m_counters[indices[j]];
+			}
+			return m_counters;
+		}
+
+
+	private:
+
+		/// Stores indices of points of a block after the part is appended to the indices of the given level
+		void append_part(std::size_t level, Part const &part, std::size_t block, IntervalIndex *out) const
+		{
+			IntervalIndex const *column = m_columns.data() + part.first*m_stride + block;
+			unsigned int const   shift  = m_digits - part.second;
+			if ( level == 0 )
+			{
+				for (std::size_t j = 0; j < sc_block_size; ++j)
+					out[j] = column[j] >> shift;
+			}
+			else
+			{
+				IntervalIndex const *previous = m_levels[level - 1].data() + block;
+				for (std::size_t j = 0; j < sc_block_size; ++j)
+					out[j] = (previous[j] << part.second) | (column[j] >> shift);
+			}
+		}
+
+		std::vector<IntervalIndex> const          &m_columns;
+		tms::CountInt                              m_count;
+		std::size_t                                m_stride;
+		tms::BasicInt                              m_digits;
+		std::vector<Part>                          m_parts;
+		std::vector< std::vector<IntervalIndex> >  m_levels;
+		std::vector<tms::CountInt>                 m_counters;
+	};
+
+}
+
+
+
+
+
+tms::analysis::EquidistributionReport tms::analysis::verify_equidistribution(DigitalNet const &net, BasicInt t)
+{
+	if ( t > net.m() )
+		throw std::invalid_argument("\nValue of t can't exceed m\n");
+	BasicInt const digits = net.m() - t;
+	if ( digits > 8*sizeof(IntervalIndex) )
+		throw std::length_error("\nToo many elementary intervals\n");
+	BasicInt const s     = net.s();
+	CountInt const count = CountInt(1) << net.m();
+
+	EquidistributionReport report;
+	report.equidistributed = true;
+	if ( digits == 0 )
+		return report;
+
+	// 1. Cut scaled coordinates to their highest digits, dimensions are padded to whole blocks
+	std::size_t const          stride = (count + sc_block_size - 1)/sc_block_size*sc_block_size;
+	std::vector<IntervalIndex> columns(stride*s, 0);
+	net.for_each_int_point_parallel([&](IntPoint const &point, CountInt pos) {
+		for (BasicInt k = 0; k < s; ++k)
+			columns[k*stride + pos] = static_cast<IntervalIndex>(point[k] >> t);
+	}, count);
+
+	// 2. Count points in intervals of compositions in parallel, chunks of compositions are walked in the
+	//    lexicographic order and compositions following the first failed one are skipped
+	CountInt const              compositions = compositions_count(digits, s);
+	CountInt const              chunk_size   = (compositions + 16*parallel::ThreadPool::global().size() - 1)/(16*parallel::ThreadPool::global().size());
+	CountInt const              chunks       = (compositions + chunk_size - 1)/chunk_size;
+	CountInt const              expected     = CountInt(1) << t;
+	std::atomic<CountInt>       first_failed(compositions);
+	parallel::for_each_index(chunks, [&](std::size_t chunk_i) {
+		CountInt const             chunk_end = std::min(compositions, (chunk_i + 1)*chunk_size);
+		std::vector<BasicInt>      composition(s);
+		IntervalCounter            counter(columns, count, stride, digits);
+		unrank_composition(chunk_i*chunk_size, digits, composition);
+		for (CountInt rank = chunk_i*chunk_size; rank < chunk_end && rank < first_failed.load(); ++rank)
+		{
+			std::vector<CountInt> const &counters = counter.count(composition);
+			if ( std::any_of(counters.begin(), counters.end(), [expected](CountInt points){ return points != expected; }) )
+			{
+				CountInt failed = first_failed.load();
+				while ( rank < failed && !first_failed.compare_exchange_weak(failed, rank) );
+				return;
+			}
+			if ( rank + 1 < compositions )
+				next_composition(composition);
+		}
+	});
+
+	// 3. Find the first interval with a wrong amount of points of the first failed composition
+	if ( first_failed.load() == compositions )
+		return report;
+	std::vector<BasicInt> composition(s);
+	unrank_composition(first_failed.load(), digits, composition);
+	IntervalCounter                 counter(columns, count, stride, digits);
+	std::vector<CountInt> const    &counters = counter.count(composition);
+	CountInt const                  index    = std::find_if(counters.begin(), counters.end(), [expected](CountInt points){ return points != expected; }) - counters.begin();
+
+	report.equidistributed           = false;
+	report.counterexample.digits     = composition;
+	report.counterexample.positions.assign(s, 0);
+	report.counterexample.points     = counters[index];
+	BasicInt offset = 0;
+	for (BasicInt k = s; k-- > 0;)
+	{
+		report.counterexample.positions[k]  = (index >> offset) & ((CountInt(1) << composition[k]) - 1);
+		offset                             += composition[k];
+	}
+	return report;
+}
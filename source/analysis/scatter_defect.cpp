@@ -6,8 +6,13 @@
  *       Andrei Eliseev (JointPoints), 2021
  */
 #include "../../include/tms-nets/analysis/analysis.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
+#include "../../include/tms-nets/details/eigen.hpp"
 #include "../../include/tms-nets/thirdparty/jacobi/jacobi.hpp"
 
+#include <algorithm>
+#include <cmath>
+
 
 
 
@@ -15,42 +20,169 @@
 using PCAMatrixRow = std::vector<tms::Real>;
 using PCAMatrix    = std::vector<PCAMatrixRow>;
 
+using tms::bitops::ExactSum;
+
 
 
 
 
-tms::Point tms::analysis::scatter_defect(tms::DigitalNet const &net)
+namespace
 {
-	CountInt        point_count     = (1ULL << net.m());
-	BasicInt        s               = net.s();
-	Real            scatter         = 0;
-	Point           point;
-	PCAMatrix       cov_matrix;
-	PCAMatrix       dummy;
 
-	Point           result(s, 0.0);
+	/// Highest dimension for which eigenvalues are found by Jacobi's method in long double, it is more accurate
+	/// but takes \f$O(s^3)\f$ per sweep, so larger matrices are tridiagonalized in double instead
+	tms::BasicInt const sc_jacobi_max_dim = 64;
+
+	/**
+	 * Exact sum of words kept as a 128-bit number, it is faster than ExactSum for coordinates scaled by at most
+	 * \f$2^{32}\f$: their products are words and sums over \f$2^{32}\f$ points never exceed \f$2^{96}\f$
+	 */
+	class NarrowSum
+	{
+	public:
+
+		/// Adds the product of two words, it must be less than \f$2^{64}\f$
+		void add_product(uint64_t a, uint64_t b)
+		{
+			uint64_t const product = a*b;
+			m_low  += product;
+			m_high += m_low < product;
+		}
+
+		/// Adds the sum to an exact one
+		void add_to(ExactSum &sum) const
+		{
+			sum.add(m_low, m_high, 0);
+		}
+
+
+	private:
+
+		uint64_t m_low  = 0;
+		uint64_t m_high = 0;
+	};
 
-	// 1. Prepare container of covariance matrix
-	cov_matrix.resize(s);
-	for (auto &row : cov_matrix)
-		row.resize(s, 0);
-	dummy.resize(s);
-	for (auto &row : dummy)
-		row.resize(s, 0);
+	/// Sums over a part of the net: coordinates and products of pairs of coordinates for \f$i \le j\f$ row by row
+	struct PartSums
+	{
+		std::vector<ExactSum> coordinates;
+		std::vector<ExactSum> products;
+	};
 
-	// 2. Update covariance matrix and scatter
-	for (CountInt point_i = 0; point_i < point_count; ++point_i)
+	/// Adds a sum over a part of the net to the total one
+	inline void add_to(ExactSum const &part_sum, ExactSum &sum)
 	{
-		point = net.generate_point(point_i);
+		sum += part_sum;
+	}
+
+	inline void add_to(NarrowSum const &part_sum, ExactSum &sum)
+	{
+		part_sum.add_to(sum);
+	}
 
+	/**
+	 * Sums coordinates and their products over a part of the net walking it with Gray's code
+	 * @tparam Sum - ExactSum or NarrowSum if points are scaled by at most \f$2^{32}\f$
+	 */
+	template <typename Sum>
+	void sum_part(tms::DigitalNet const &net, tms::PointRange const &range, PartSums &part)
+	{
+		tms::BasicInt const s = net.s();
+		std::vector<Sum>    coordinates(s);
+		std::vector<Sum>    products(static_cast<std::size_t>(s)*(s + 1)/2);
+		net.for_each_int_point([&](tms::IntPoint const &point, tms::CountInt) {
+			Sum *product = products.data();
+			for (tms::BasicInt i = 0; i < s; ++i)
+			{
+				coordinates[i].add_product(point[i], 1);
+				for (tms::BasicInt j = i; j < s; ++j)
+					(product++)->add_product(point[i], point[j]);
+			}
+		}, range.amount, range.pos);
+
+		part.coordinates.resize(s);
+		part.products.resize(products.size());
+		for (tms::BasicInt i = 0; i < s; ++i)
+			add_to(coordinates[i], part.coordinates[i]);
+		for (std::size_t pair_i = 0; pair_i < products.size(); ++pair_i)
+			add_to(products[pair_i], part.products[pair_i]);
+	}
+
+}
+
+
+
+
+
+tms::Point tms::analysis::scatter_defect(tms::DigitalNet const &net, unsigned int threads)
+{
+	CountInt          point_count     = (1ULL << net.m());
+	BasicInt          s               = net.s();
+	Real              scatter         = 0;
+	std::vector<Real> cov_matrix(static_cast<std::size_t>(s)*s, 0);    // row-major
+
+	Point             result(s, 0.0);
+
+	// 1. Sum scaled coordinates and their products exactly, parts of the net are walked with Gray's code on
+	//    several threads and reduced in a fixed order, so the result doesn't depend on the amount of threads
+	std::vector<PointRange> const ranges = DigitalNet::split_range(point_count, 0, 4*parallel::concurrency(threads));
+	std::vector<PartSums>         sums(ranges.size());
+	parallel::for_each_index(ranges.size(), [&](std::size_t range_i) {
+		if ( net.m() <= 32 )
+			sum_part<NarrowSum>(net, ranges[range_i], sums[range_i]);
+		else
+			sum_part<ExactSum>(net, ranges[range_i], sums[range_i]);
+	}, threads);
+	for (std::size_t range_i = 1; range_i < sums.size(); ++range_i)
+	{
 		for (BasicInt i = 0; i < s; ++i)
-			for (BasicInt j = i; j < s; ++j)
-				cov_matrix[i][j] = cov_matrix[j][i] += (point[i] - 0.5) * (point[j] - 0.5);
+			sums[0].coordinates[i] += sums[range_i].coordinates[i];
+		for (std::size_t pair_i = 0; pair_i < sums[0].products.size(); ++pair_i)
+			sums[0].products[pair_i] += sums[range_i].products[pair_i];
+	}
+
+	// 2. Fill covariance matrix: sum of (x_i - c)(x_j - c) = sum of x_i x_j - c (sum of x_i + sum of x_j) + N c^2
+	//    for scaled coordinates and c = 2^(m - 1), it is centered exactly and scaled back by 2^(-2m) afterwards;
+	//    a net with m = 0 is the origin alone, and c = 1/2 isn't a scaled coordinate, so it is filled directly
+	if ( net.m() == 0 )
+	{
+		std::fill(cov_matrix.begin(), cov_matrix.end(), 0.25);
+	}
+	else
+	{
+		ExactSum centre_square;
+		centre_square.add_product(point_count, 1ULL << (net.m() - 1));
+		centre_square <<= net.m() - 1;
+		for (BasicInt i = 0, pair_i = 0; i < s; ++i)
+		{
+			for (BasicInt j = i; j < s; ++j, ++pair_i)
+			{
+				ExactSum centred = sums[0].coordinates[i];
+				centred         += sums[0].coordinates[j];
+				centred        <<= net.m() - 1;
+				ExactSum sum     = sums[0].products[pair_i];
+				sum             += centre_square;
+				sum             -= centred;
+				cov_matrix[i*s + j] = cov_matrix[j*s + i] = sum.value(2*static_cast<int>(net.m()));
+			}
+		}
 	}
 
 	// 3. Retrieve eigenvalues of covariance matrix
-	jacobi_public_domain::Jacobi<Real, PCAMatrixRow &, PCAMatrix &> diagonaliser(s);
-	diagonaliser.Diagonalize(cov_matrix, result, dummy);
+	if ( s <= sc_jacobi_max_dim )
+	{
+		PCAMatrix matrix(s, PCAMatrixRow(s, 0));
+		PCAMatrix dummy(s, PCAMatrixRow(s, 0));
+		for (BasicInt i = 0; i < s; ++i)
+			std::copy(cov_matrix.begin() + i*s, cov_matrix.begin() + (i + 1)*s, matrix[i].begin());
+		jacobi_public_domain::Jacobi<Real, PCAMatrixRow &, PCAMatrix &> diagonaliser(s);
+		diagonaliser.Diagonalize(matrix, result, dummy);
+	}
+	else
+	{
+		std::vector<double> const eigenvalues = eigen::symmetric_eigenvalues(std::vector<double>(cov_matrix.begin(), cov_matrix.end()), s);
+		std::copy(eigenvalues.begin(), eigenvalues.end(), result.begin());
+	}
 
 	// 4. Calculate defect
 	std::for_each(result.begin(), result.end(), [&scatter](Real value){scatter += value * value;});
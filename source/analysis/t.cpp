@@ -11,8 +11,14 @@
  */
 #include "../../include/tms-nets/analysis/analysis.hpp"
 
+#include "../../include/tms-nets/details/bitops.hpp"
+#include "../../include/tms-nets/details/parallel.hpp"
+
 #include <stdexcept>    // needed for exceptions
-#include <algorithm>    // needed for "equal"
+#include <algorithm>    // needed for "min" and "max_element"
+#include <array>
+#include <atomic>
+#include <cstdint>
 
 
 
@@ -24,104 +30,122 @@
 
 
 
-typedef std::vector<bool>           RAREFVector;
-typedef std::vector<RAREFVector>    RAREFMatrix;
+/*
+ * Rows of matrices over F2 are packed into words: the j-th element of a row of a generating matrix is
+ * the (m - 1 - j)-th bit (see tms::GenMatRow). Matrices never have more than 64 rows or columns.
+ */
+typedef uint64_t                 RAREFVector;
+typedef std::vector<RAREFVector> RAREFMatrix;
 
+/*
+ * Reduced form T = L C of a matrix C with invertible L. Every nonzero row of T owns a pivot: a bit that is set
+ * in this row only among the rows owning pivots. Rows of T keep the positions of the rows of C they originate
+ * from, zero rows of T are the dependencies between rows of C. Rank of C is the amount of pivots.
+ */
 typedef struct RAREF
 {
 	RAREFMatrix L;
 	RAREFMatrix T;
-	std::vector<size_t> p;
+	// mask of pivot bits and the rows owning them
+	uint64_t                pivots;
+	std::array<uint8_t, 64> pivot_rows;
 } RAREF;
 
 typedef std::vector<size_t>      Composition;
-typedef std::vector<Composition> Compositions;
 
-// Debug
-/*void print_matrix(RAREFMatrix const &matrix)
+/*
+ * Make i-th row of RAREF a pivot one if it is independent from the others.
+ * The row is reduced by the pivot rows first, then its lowest bit becomes a new pivot and is cleared
+ * from the other pivot rows, so pivots stay unique to their rows.
+ */
+inline void insert_row(RAREF &raref, size_t const i)
 {
-	for (auto i : matrix)
+	for (uint64_t common = raref.T[i] & raref.pivots; common != 0; common = raref.T[i] & raref.pivots)
 	{
-		for (auto j : i)
+		size_t const pivot_row = raref.pivot_rows[tms::bitops::count_trailing_zeros(common)];
+		raref.T[i] ^= raref.T[pivot_row];
+		raref.L[i] ^= raref.L[pivot_row];
+	}
+	if (raref.T[i] == 0)
+	{
+		return;
+	}
+	unsigned int const pivot      = tms::bitops::count_trailing_zeros(raref.T[i]);
+	uint64_t     const pivot_mask = 1ULL << pivot;
+	for (uint64_t pivots = raref.pivots; pivots != 0; pivots &= pivots - 1)
+	{
+		size_t const row_i = raref.pivot_rows[tms::bitops::count_trailing_zeros(pivots)];
+		if (raref.T[row_i] & pivot_mask)
 		{
-			std::cout << j << " ";
+			raref.T[row_i] ^= raref.T[i];
+			raref.L[row_i] ^= raref.L[i];
 		}
-		std::cout << std::endl;
 	}
+	raref.pivots |= pivot_mask;
+	raref.pivot_rows[pivot] = static_cast<uint8_t>(i);
 }
 
-void print_RAREF(RAREF const &r, std::string const &name)
-{
-	std::cout << "RAREF for " << name << ":" << std::endl;
-	std::cout << "L:" << std::endl;
-	print_matrix(r.L);
-	std::cout << "T:" << std::endl;
-	print_matrix(r.T);
-	std::cout << "p:" << std::endl;
-	for (auto i : r.p)
-	{
-		std::cout << i << " ";
-	}
-	std::cout << std::endl
-			  << std::endl;
-}*/
-// Debug
-
 /*
- * Change row to absolute value of subtaction with another row
+ * Positive compositions of q of length u enumerated in place in a Gray order: every next composition is
+ * obtained from the previous one by moving a unit from one part to another, so the matrices of two consequent
+ * compositions differ by exactly one row. The first composition is (1, ..., 1, q - u + 1).
+ *
+ * Parts decreased by one form a weak composition (a_0, ..., a_{u - 1}) of q - u. For every value of a_0 from
+ * its range the rest parts are enumerated recursively, alternately forward and backward, hence when a level
+ * has passed its whole range all the deeper ones have as well and all their units are gathered in a single
+ * part: the first deeper one if it went forward, the last one otherwise. Direction of a level is determined by
+ * the direction of the previous level and the parity of its part.
  */
-inline void subtract_row(RAREFMatrix &matrix, size_t min_ind, size_t sub_ind)
+typedef struct CompositionIterator
 {
-	std::transform(matrix[min_ind].begin(), matrix[min_ind].end(),
-				   matrix[sub_ind].begin(), matrix[min_ind].begin(),
-				   [](bool a, bool b) { return a != b; });
-}
+	Composition       parts;
+	std::vector<bool> backward;
+} CompositionIterator;
 
 /*
- * Swap rows in matrix
+ * Set iterator to the first composition of q of length u
  */
-inline void swap_row(RAREFMatrix &matrix, size_t row1_ind, size_t row2_ind)
+void first_composition(CompositionIterator &it, size_t q, size_t u)
 {
-	std::swap(matrix[row1_ind], matrix[row2_ind]);
-}
-
-RAREFMatrix ident_matrix(size_t size)
-{
-	RAREFMatrix res(size, RAREFVector(size, 0));
-	for (size_t i = 0; i < size; i++)
-	{
-		res[i][i] = 1;
-	}
-	return res;
+	it.parts.assign(u, 1);
+	it.parts[u - 1] = q - u + 1;
+	it.backward.assign(u, false);
 }
 
-void composition_recursive(Composition compos, size_t curr_ind, Compositions &res)
+/*
+ * Move iterator to the next composition, the unit is moved from part <from> to part <to>.
+ * Returns false if the composition is the last one.
+ */
+bool next_composition(CompositionIterator &it, size_t &from, size_t &to)
 {
-	if (curr_ind >= compos.size() - 1)
-	{
-		return;
-	}
-	composition_recursive(compos, curr_ind + 1, res);
-	if (compos[curr_ind] > 1)
+	size_t const u = it.parts.size();
+	for (size_t i = u - 1; i-- > 0; )
 	{
-		compos[curr_ind]--;
-		compos[curr_ind + 1]++;
-		res.push_back(compos);
-		composition_recursive(compos, curr_ind, res);
+		// part keeping all units of the levels deeper than i
+		size_t const holder = (i + 2 == u || !it.backward[i + 1]) ? i + 1 : u - 1;
+		if (!it.backward[i] && it.parts[holder] > 1)
+		{
+			from = holder;
+			to   = i;
+		}
+		else if (it.backward[i] && it.parts[i] > 1)
+		{
+			from = i;
+			to   = holder;
+		}
+		else
+		{
+			continue;
+		}
+		--it.parts[from];
+		++it.parts[to];
+		for (size_t j = i + 1; j + 1 < u; j++)
+		{
+			it.backward[j] = it.backward[j - 1] != ((it.parts[j - 1] - 1) % 2 == 1);
+		}
+		return true;
 	}
-}
-
-/*
- * Generate compositions of q of length u
- */
-Compositions generate_compositions(size_t q, size_t u)
-{
-	Compositions result;
-	Composition compos(u, 1);
-	compos[0] = q - u + 1;
-	result.push_back(compos);
-	composition_recursive(compos, 0, result);
-	return result;
+	return false;
 }
 
 /*
@@ -146,367 +170,411 @@ size_t binomial_coefficient(size_t n, size_t k)
 }
 
 /*
- * Generate compositions from [from:to] of size k
+ * Binomial coefficients C(n, k) for n <= n_max and k <= k_max, the k-th element of the n-th row is C(n, k).
+ * Coefficients exceeding the range of tms::CountInt are replaced with its maximum.
  */
-Compositions binomial_coefficient(size_t from, size_t to, size_t k)
+std::vector<std::vector<tms::CountInt>> binomial_table(size_t n_max, size_t k_max)
 {
-	size_t n = to - from + 1;
-	std::vector<bool> sep(n, 0);
-	std::fill(sep.begin(), sep.begin() + k, 1);
-
-	Compositions res;
-
-	do
+	tms::CountInt const                     saturated = ~tms::CountInt(0);
+	std::vector<std::vector<tms::CountInt>> table(n_max + 1, std::vector<tms::CountInt>(k_max + 1, 0));
+	for (size_t n = 0; n <= n_max; n++)
 	{
-		Composition compos;
-		for (size_t i = 0; i < n; i++)
+		table[n][0] = 1;
+		for (size_t k = 1; k <= std::min(n, k_max); k++)
 		{
-			if (sep[i])
-			{
-				compos.push_back(i + from);
-			}
+			table[n][k] = table[n - 1][k - 1] > saturated - table[n - 1][k] ? saturated : table[n - 1][k - 1] + table[n - 1][k];
 		}
-		res.push_back(compos);
-	} while (std::prev_permutation(sep.begin(), sep.end()));
-	return res;
+	}
+	return table;
 }
 
 /*
- * Compute RAREF for matrix C
+ * Set <subset> to the subset of coordinates c_0 < ... < c_{u - 1} with the colexicographic index
+ * sum C(c_i, i + 1) equal to <index>
  */
-RAREF compute_RAREF(RAREFMatrix const &C, RAREFMatrix const &L)
+void unrank_combination(tms::CountInt index, std::vector<std::vector<tms::CountInt>> const &binomials, Composition &subset)
 {
-	size_t q = C.size();
-	if (!q)
-	{
-		throw std::logic_error("\nWrong C dimensions");
-	}
-	size_t k = C[0].size();
-	if (q > k)
+	for (size_t i = subset.size(); i-- > 0; )
 	{
-		throw std::logic_error("\nWrong C dimensions");
+		size_t c = i;
+		while (binomials[c + 1][i + 1] <= index)
+		{
+			++c;
+		}
+		subset[i] = c;
+		index    -= binomials[c][i + 1];
 	}
+}
 
-	RAREF res;
-	res.L = L;
-	res.T = C;
-	res.p = {};
-
-	for (size_t i = 0; i < q; i++)
+/*
+ * Move <subset> to the next one in colexicographic order: the lowest coordinate that can be increased is
+ * increased and the lower ones are reset
+ */
+inline void next_combination(Composition &subset)
+{
+	size_t i = 0;
+	while (i + 1 < subset.size() && subset[i] + 1 == subset[i + 1])
 	{
-		size_t j = 0;
-		for (; j < k; j++)
-		{
-			if (res.T[i][j] == 0)
-			{
-				for (size_t i2 = i + 1; i2 < q; i2++)
-				{
-					if (res.T[i2][j] == 1)
-					{
-						swap_row(res.T, i, i2);
-						swap_row(res.L, i, i2);
-						break;
-					}
-				}
-			}
-			if (res.T[i][j] == 1)
-			{
-				res.p.push_back(j);
-				break;
-			}
-		}
-		j = j == k ? k - 1 : j;
-		for (size_t i2 = 0; i2 < q; i2++)
-		{
-			if (i2 != i && (res.T[i2][j] == 1))
-			{
-				subtract_row(res.T, i2, i);
-				subtract_row(res.L, i2, i);
-			}
-		}
+		subset[i] = i;
+		++i;
 	}
-	return res;
+	++subset[i];
 }
 
 /*
- * Call compute_RAREF with identity matrix as L
+ * Colexicographic index of <subset> without its <removed>-th coordinate
  */
-RAREF compute_RAREF(RAREFMatrix const &C)
+inline size_t subprojection_index(Composition const &subset, size_t removed,
+                                  std::vector<std::vector<tms::CountInt>> const &binomials)
 {
-	size_t q = C.size();
-	return compute_RAREF(C, ident_matrix(q));
+	size_t res = 0;
+	for (size_t i = 0; i < subset.size(); i++)
+	{
+		if (i != removed)
+		{
+			res += binomials[subset[i]][i < removed ? i + 1 : i];
+		}
+	}
+	return res;
 }
 
 /*
- * Update calculated RAREF for matrix with difference in only one row
+ * Compute RAREF for matrix C in place, memory of the previous RAREF is reused
  */
-RAREF update_RAREF(RAREFMatrix const &C, RAREFMatrix const &C2, RAREF const &src)
+void compute_RAREF(RAREFMatrix const &C, RAREF &raref)
 {
 	size_t q = C.size();
-	if (!q)
+	if (!q || q > 64)
 	{
 		throw std::logic_error("\nWrong C dimensions");
 	}
-	size_t k = C[0].size();
-	if (q > k)
+
+	raref.T = C;
+	raref.L.resize(q);
+	for (size_t i = 0; i < q; i++)
 	{
-		throw std::logic_error("\nWrong C dimensions");
+		raref.L[i] = 1ULL << i;
 	}
-	if (C2.size() != q || C2[0].size() != k)
+	raref.pivots = 0;
+	for (size_t i = 0; i < q; i++)
 	{
-		throw std::logic_error("\nWrong C2 dimensions");
+		insert_row(raref, i);
 	}
+}
 
+/*
+ * Compute RAREF for matrix C with identity matrix as initial L
+ */
+RAREF compute_RAREF(RAREFMatrix const &C)
+{
 	RAREF res;
-	res.L = src.L;
-	res.T = src.T;
-	res.p = src.p;
+	compute_RAREF(C, res);
+	return res;
+}
 
-	if (C == C2)
+/*
+ * Rank of the matrix RAREF is computed for
+ */
+inline size_t RAREF_rank(RAREF const &raref)
+{
+	return tms::bitops::count_ones(raref.pivots);
+}
+
+/*
+ * Update calculated RAREF for matrix C in place, so that it becomes the RAREF for the matrix obtained from C
+ * by replacing its <row_i>-th row with <new_row>
+ */
+void update_RAREF(RAREF &raref, size_t row_i, RAREFVector new_row)
+{
+	size_t q = raref.T.size();
+	if (row_i >= q)
 	{
-		return res;
+		throw std::logic_error("\nWrong row index");
 	}
 
-	size_t diff_row = 0;
+	// Rows of T depending on the changed row of C are those having the row_i-th bit of L set. One of them
+	// (a zero row if possible, so that no pivot is lost) is added to the others and then replaced by the new row.
+	uint64_t const diff_mask = 1ULL << row_i;
+	size_t         replaced  = q;
 	for (size_t i = 0; i < q; i++)
 	{
-		for (size_t j = 0; j < k; j++)
+		if ((raref.L[i] & diff_mask) && (replaced == q || raref.T[i] == 0))
 		{
-			if (C[i][j] != C2[i][j])
-			{
-				diff_row = i;
-			}
+			replaced = i;
 		}
 	}
-
 	for (size_t i = 0; i < q; i++)
 	{
-		if (res.L[i][diff_row] == 1)
+		if (i != replaced && (raref.L[i] & diff_mask))
 		{
-			swap_row(res.T, i, diff_row);
-			swap_row(res.L, i, diff_row);
-			break;
+			raref.T[i] ^= raref.T[replaced];
+			raref.L[i] ^= raref.L[replaced];
 		}
 	}
-
-	for (size_t i = 0; i < q; i++)
+	// the pivot of the replaced row becomes an ordinary bit of the rows it was added to,
+	// their own pivots are still unique since the replaced row had none of them
+	if (raref.T[replaced] != 0)
 	{
-		if (i != diff_row && res.L[i][diff_row] == 1)
+		for (uint64_t pivots = raref.pivots; pivots != 0; pivots &= pivots - 1)
 		{
-			subtract_row(res.T, i, diff_row);
-			subtract_row(res.L, i, diff_row);
-			for (size_t j = 0; j < k; j++)
+			unsigned int const pivot = tms::bitops::count_trailing_zeros(pivots);
+			if (raref.pivot_rows[pivot] == replaced)
 			{
-				if (res.T[diff_row][j] == 1)
-				{
-					std::remove(res.p.begin(), res.p.end(), j);
-				}
+				raref.pivots ^= 1ULL << pivot;
+				break;
 			}
 		}
 	}
 
-	for (size_t i = 0; i < q; i++)
+	raref.T[replaced] = new_row;
+	raref.L[replaced] = diff_mask;
+	insert_row(raref, replaced);
+}
+
+/*
+ * Reduced forms of the leading rows of the matrix of the first composition of q kept for the last projection
+ * checked with this q. The matrix holds the rows of the coordinates from the last one to the first one, and
+ * levels[P] is the RAREF after the rows of the coordinates subset[u - 1], ..., subset[P] are inserted (P >= 1).
+ */
+typedef struct PrefixCache
+{
+	Composition        subset;
+	std::vector<RAREF> levels;
+} PrefixCache;
+
+/*
+ * Buffers of a thread checking projections, so that nothing is reallocated for every composition
+ */
+typedef struct ProjectionBuffers
+{
+	RAREF               r;
+	CompositionIterator composition;
+	// the row of the matrix holding the j-th row of the i-th generating matrix of a projection is slots[64 i + j]
+	std::vector<uint8_t> slots;
+	// reduced prefixes for every q
+	std::vector<PrefixCache> prefixes = std::vector<PrefixCache>(65);
+} ProjectionBuffers;
+
+/*
+ * Insert the row at position <pos> of the matrix into the RAREF of the rows preceding it
+ */
+inline void append_row(RAREF &raref, size_t const pos, RAREFVector const row)
+{
+	raref.T[pos] = row;
+	raref.L[pos] = 1ULL << pos;
+	insert_row(raref, pos);
+}
+
+/*
+ * Set <buffers.r> to the RAREF of the matrix of the first composition (1, ..., 1, q - u + 1) of q for the projection
+ * onto <subset>. Consecutive projections in colexicographic order differ in their lowest coordinates only, so the
+ * reduced rows of the coinciding highest coordinates are taken from the cache and only the rows of the changed
+ * ones are inserted.
+ */
+void first_composition_RAREF(Composition const &subset, size_t q, std::vector<RAREFMatrix> const &gen_mat,
+                             ProjectionBuffers &buffers)
+{
+	size_t const          u     = subset.size();
+	RAREF                &r     = buffers.r;
+	PrefixCache          &cache = buffers.prefixes[q];
+	std::vector<uint8_t> &slots = buffers.slots;
+
+	// rows of the last coordinate come first, then a single row of every coordinate from u - 2 to 0
+	slots.resize(64*u);
+	for (size_t row_i = 0; row_i + u <= q; row_i++)
+	{
+		slots[64*(u - 1) + row_i] = static_cast<uint8_t>(row_i);
+	}
+	for (size_t P = 0; P + 1 < u; P++)
 	{
-		if (i != diff_row)
+		slots[64*P] = static_cast<uint8_t>(q - 1 - P);
+	}
+
+	size_t level = u;
+	if (cache.subset.size() == u)
+	{
+		while (level > 1 && cache.subset[level - 1] == subset[level - 1])
 		{
-			res.L[diff_row][i] = 0;
+			--level;
 		}
 	}
+	if (level == u)
+	{
+		r.T.resize(q);
+		r.L.resize(q);
+		r.pivots = 0;
+		for (size_t row_i = 0; row_i + u <= q; row_i++)
+		{
+			append_row(r, row_i, gen_mat[subset[u - 1]][row_i]);
+		}
+		cache.levels.resize(u);
+		cache.levels[u - 1] = r;
+		level = u - 1;
+	}
+	else
+	{
+		r = cache.levels[level];
+	}
+	for (size_t P = level; P-- > 0; )
+	{
+		append_row(r, q - 1 - P, gen_mat[subset[P]][0]);
+		if (P != 0)
+		{
+			cache.levels[P] = r;
+		}
+	}
+	cache.subset = subset;
+}
 
-	res.T[diff_row] = C2[diff_row];
+/*
+ * Lower the shared minimum to <value> if it is less
+ */
+inline void lower_bound_to(std::atomic<size_t> &bound, size_t const value)
+{
+	size_t current = bound.load(std::memory_order_relaxed);
+	while (value < current && !bound.compare_exchange_weak(current, value, std::memory_order_relaxed))
+	{
+	}
+}
 
-	for (size_t i = 0; i < res.p.size(); i++)
+/*
+ * Find the largest q such that the matrices of all compositions of q of length u are of full rank for the
+ * projection onto the coordinates <subset>, u - 1 if there is no such q. Only q not exceeding the current
+ * minimum <bound> over all projections are checked, and a check is given up as soon as another thread lowers
+ * <bound> below q, since the projection can only lower the minimum then. Hence the result is exact only
+ * if it is less than the final value of <bound>.
+ */
+size_t projection_rho(Composition const &subset, std::vector<RAREFMatrix> const &gen_mat,
+                      std::atomic<size_t> const &bound, ProjectionBuffers &buffers)
+{
+	size_t const          u           = subset.size();
+	RAREF                &r           = buffers.r;
+	CompositionIterator  &composition = buffers.composition;
+	std::vector<uint8_t> &slots       = buffers.slots;
+	size_t q = bound.load(std::memory_order_relaxed);
+	while (q >= u)
 	{
-		size_t pivot = res.p[i];
-		size_t I = 0;
-		for (size_t j = 0; j < q; j++)
+		// rows of the matrix are kept in place, a row moved by the next composition takes the slot of the removed one
+		first_composition(composition, q, u);
+		first_composition_RAREF(subset, q, gen_mat, buffers);
+		bool   flag = RAREF_rank(r) < q;
+		size_t from;
+		size_t to;
+		while (!flag && next_composition(composition, from, to))
 		{
-			if (res.T[j][pivot] == 1 && j != diff_row)
+			if (bound.load(std::memory_order_relaxed) < q)
 			{
-				I = j;
+				flag = true;
+				break;
 			}
+			size_t const slot   = slots[64*from + composition.parts[from]];
+			size_t const row_i  = composition.parts[to] - 1;
+			slots[64*to + row_i] = static_cast<uint8_t>(slot);
+			update_RAREF(r, slot, gen_mat[subset[to]][row_i]);
+			flag = RAREF_rank(r) < q;
 		}
-		if (res.T[diff_row][pivot] == 1)
+		if (!flag)
 		{
-			subtract_row(res.T, diff_row, I);
-			subtract_row(res.L, diff_row, I);
+			return q;
 		}
+		q = std::min(q - 1, bound.load(std::memory_order_relaxed));
 	}
-	return compute_RAREF(res.T, res.L);
+	return u - 1;
 }
 
 /*
- * Add rows from [0:to] of src to the end of dst
- * If <reverse> == true, rows will be added in reverse order
+ * Lower the minimum <rho> of the largest q over all projections of lower order to the one over all projections
+ * of order u as well. Projections are distributed among threads.
  */
-void add_rows(RAREFMatrix &dst, RAREFMatrix const &src, size_t const to, bool const reverse = false)
+void generate_projections(size_t s, size_t u, std::vector<RAREFMatrix> const &gen_mat,
+                          std::vector<std::vector<tms::CountInt>> const &binomials, std::atomic<size_t> &rho)
 {
-	size_t n = to + 1;
-	for (size_t i = 0; i < n; i++)
+	tms::CountInt const count = binomials[s][u];
+	if (count == ~tms::CountInt(0))
 	{
-		size_t ind = (reverse) ? (to - i) : (i);
-		dst.push_back(src[ind]);
+		throw std::length_error("\nToo many projections\n");
 	}
-	return;
+	// projections take different time, so there are many chunks for threads to balance the load
+	tms::CountInt const chunk_size   = std::max<tms::CountInt>(1, count/(16*tms::parallel::ThreadPool::global().size()));
+	tms::CountInt const chunks_count = (count + chunk_size - 1)/chunk_size;
+	tms::parallel::for_each_index(static_cast<std::size_t>(chunks_count), [&](std::size_t chunk_i) {
+		ProjectionBuffers   buffers;
+		Composition         subset(u);
+		tms::CountInt const begin = chunk_i*chunk_size;
+		tms::CountInt const end   = std::min(count, begin + chunk_size);
+		unrank_combination(begin, binomials, subset);
+		for (tms::CountInt i = begin; i < end && rho.load(std::memory_order_relaxed) >= u; i++, next_combination(subset))
+		{
+			lower_bound_to(rho, projection_rho(subset, gen_mat, rho, buffers));
+		}
+	});
 }
 
-Composition generate_projections(size_t s, size_t u, size_t k,
-                                 std::vector<RAREFMatrix> const &gen_mat, Composition const &rho)
+/*
+ * Compute largest q for every projection of order u onto the coordinates c_0 < ... < c_{u - 1} and store it
+ * at the colexicographic index sum C(c_i, i + 1) of <rho>[u - 1]. Largest q of a projection is never greater
+ * than the ones of its subprojections of order u - 1 (found in <rho>[u - 2]), so checks start from their minimum.
+ */
+void generate_projections_exactly(size_t s, size_t u, std::vector<RAREFMatrix> const &gen_mat,
+                                  std::vector<std::vector<tms::CountInt>> const &binomials,
+                                  std::vector<std::vector<size_t>> &rho)
 {
-	size_t qmax = u == 2 ? k : *std::min_element(rho.begin(), rho.end());
-	Composition res;
-	Compositions c = binomial_coefficient(0, s - 1, u);
-	for (size_t i = 0; i < c.size(); i++)
+	if (binomials[s][u] == ~tms::CountInt(0))
 	{
-		size_t ro_tilda;
-		size_t curr_rank = u - 1;
-		for (size_t q = qmax; q >= u; q--)
+		throw std::length_error("\nToo many projections\n");
+	}
+	std::vector<size_t> const &sub_rho = rho[u - 2];
+	rho[u - 1].assign(binomials[s][u], 0);
+	size_t const count        = rho[u - 1].size();
+	size_t const chunk_size   = std::max<size_t>(1, count/(16*tms::parallel::ThreadPool::global().size()));
+	size_t const chunks_count = (count + chunk_size - 1)/chunk_size;
+	tms::parallel::for_each_index(chunks_count, [&](std::size_t chunk_i) {
+		ProjectionBuffers buffers;
+		Composition       subset(u);
+		size_t const      begin = chunk_i*chunk_size;
+		size_t const      end   = std::min(count, begin + chunk_size);
+		unrank_combination(begin, binomials, subset);
+		for (size_t index = begin; index < end; index++, next_combination(subset))
 		{
-			bool                flag                    = false;
-			Compositions        comp_arr                = generate_compositions(q, u);
-			RAREFMatrix         matrix                  = {};
-			std::vector<bool>   is_section_reversed(comp_arr[0].size(), false);
-			RAREF               r;
-			for (size_t j = 0; j < comp_arr.size(); j++)
+			size_t subset_qmax = sub_rho[subprojection_index(subset, 0, binomials)];
+			for (size_t removed = 1; removed < u; removed++)
 			{
-				size_t matrix_rank;
-				if (j >= 1)
-				{
-					// Try to update RAREF faster
-					Composition abs_diff(comp_arr[0].size());
-					std::transform(comp_arr[j].begin(), comp_arr[j].end(), comp_arr[j - 1].begin(),
-					               abs_diff.begin(), [](size_t a, size_t b){return std::max(a, b) - std::min(a, b);});
-					// We study two consequent compositions. Faster computation is applicable, if:
-					//     1. a new composite matrix <matrix> differs from the previous by eactly one row,
-					//        which basically means that there is a pair of two adjacent sections in the previous matrix
-					//        such that if the "upper section" "loses" one row and the "lower section" "adds" one new row,
-					//        the previous matrix becomes a new matrix;
-					//     2. the "upper section" is packed in direct order and the "lower section" is packed in reversed
-					//        order.
-					bool    fast_update_available       = false;
-					size_t  fast_update_lower_section   = 0;
-					for (size_t section_i = 0; section_i < comp_arr[0].size() - 1; ++section_i)
-					{
-						if (std::abs(static_cast<int>(comp_arr[j][section_i] - comp_arr[j - 1][section_i])) > 1)
-						{
-							fast_update_available = false;
-							break;
-						}
-						if ((std::abs(static_cast<int>(comp_arr[j][section_i]     - comp_arr[j - 1][section_i]))     == 1)  &&
-						    (std::abs(static_cast<int>(comp_arr[j][section_i + 1] - comp_arr[j - 1][section_i + 1])) == 1)  &&
-						    ((!is_section_reversed[section_i] && is_section_reversed[section_i + 1]) || (!is_section_reversed[section_i] && !is_section_reversed[section_i + 1] && (comp_arr[j - 1][section_i + 1] == 1))))
-						{
-							if (!fast_update_available)
-							{
-								fast_update_available = true;
-								fast_update_lower_section = section_i + 1;
-							}
-							else
-							{
-								fast_update_available = false;
-								break;
-							}
-						}
-					}
-					if (std::abs(static_cast<int>(comp_arr[j][comp_arr[0].size() - 1] - comp_arr[j - 1][comp_arr[0].size() - 1])) > 1)
-						fast_update_available = false;
-					// If fast update is available, update faster
-					if (fast_update_available)
-					{
-						RAREFMatrix old_matrix = matrix;
-						matrix = {};
-
-						for (size_t P = 0; P < comp_arr[0].size(); P++)
-						{
-							if (P != fast_update_lower_section)
-							{
-								add_rows(matrix, gen_mat[c[i][P]], comp_arr[j][P] - 1);
-								is_section_reversed[P] = false;
-							}
-							else
-							{
-								add_rows(matrix, gen_mat[c[i][P]], comp_arr[j][P] - 1, true);
-								is_section_reversed[P] = true;
-							}
-						}
-						r = update_RAREF(old_matrix, matrix, r);
-						matrix_rank = r.p.size();
-					}
-					// Otherwise, update slowly :(
-					else
-					{
-						matrix = {};
-						for (size_t P = 0; P < comp_arr[0].size(); P++)
-						{
-							add_rows(matrix, gen_mat[c[i][P]], comp_arr[j][P] - 1);
-							is_section_reversed[P] = false;
-						}
-						r = compute_RAREF(matrix);
-						matrix_rank = r.p.size();
-					}
-				}
-				else
-				{
-					for (size_t P = 0; P < comp_arr[0].size(); P++)
-					{
-						add_rows(matrix, gen_mat[c[i][P]], comp_arr[j][P] - 1);
-						is_section_reversed[P] = false;
-					}
-					r = compute_RAREF(matrix);
-					matrix_rank = r.p.size();
-				}
-				if (matrix_rank < q)
-				{
-					flag = true;
-					break;
-				}
-				else
-				{
-					curr_rank = q;
-				}
-			}
-			if (!flag)
-			{
-				break;
+				subset_qmax = std::min(subset_qmax, sub_rho[subprojection_index(subset, removed, binomials)]);
 			}
+			std::atomic<size_t> const bound(subset_qmax);
+			rho[u - 1][index] = std::min(subset_qmax, projection_rho(subset, gen_mat, bound, buffers));
 		}
-		ro_tilda = curr_rank;
-		res.push_back(std::min(ro_tilda, qmax));
-	}
-	return res;
+	});
 }
 
 /*
  * Find defect of (t,m,s)-net
  */
-Composition find_rho_inner(size_t k, size_t s, size_t dmax,
-                         std::vector<RAREFMatrix> const &gen_mat)
+size_t find_rho_inner(size_t k, size_t s, size_t dmax,
+                      std::vector<RAREFMatrix> const &gen_mat)
 {
-	Composition rho;
-	if (s == 1)
-	{
-		rho.push_back(k);
-		return rho;
-	}
-	for (size_t u = 2; u <= dmax; u++)
+	std::atomic<size_t> rho(k);
+	// once rho is less than u, no composition of length u is left to check
+	size_t const        umax      = std::min(dmax, k);
+	auto const          binomials = binomial_table(s, umax);
+	for (size_t u = 2; u <= umax && u <= rho.load(); u++)
 	{
-		rho = generate_projections(s, u, k, gen_mat, rho);
+		generate_projections(s, u, gen_mat, binomials, rho);
 	}
-	return rho;
+	return rho.load();
 }
 
+
 /*
- * Cast matrix of uints to matrix of bools
+ * Cast generating matrix to matrix of packed rows
  */
 RAREFMatrix cast_matrix(tms::GenMat const &src)
 {
 	RAREFMatrix dst;
+	dst.reserve(src.size());
 	for (tms::BasicInt i = 0; i < src.size(); ++i)
 	{
-		RAREFVector row;
-		for (tms::BasicInt j = 0; j < src.size(); ++j)
-			row.push_back(src[i][j]);
-		dst.push_back(row);
+		dst.push_back(src[i].bits());
 	}
 	return dst;
 }
@@ -514,26 +582,28 @@ RAREFMatrix cast_matrix(tms::GenMat const &src)
 /*
  * Calculate determinant over F2
  */
-bool det(RAREFMatrix matrix)
+bool det(RAREFMatrix const &matrix)
 {
-	for (size_t leading_column_i = 0; leading_column_i < matrix[0].size(); ++leading_column_i)
-	{
-		size_t row_i = leading_column_i;
-		for (; row_i < matrix.size(); ++row_i)
-			if (matrix[row_i][leading_column_i])
-				break;
-		if (row_i == matrix.size())
-			return false;
-		swap_row(matrix, leading_column_i, row_i);
-		for (++row_i; row_i < matrix.size(); ++row_i)
-			if (matrix[row_i][leading_column_i])
-				subtract_row(matrix, row_i, leading_column_i);
-	}
-	RAREFVector verifier(matrix[0].size(), false);
-	verifier.back() = true;
-	return std::equal(matrix.back().begin(), matrix.back().end(), verifier.begin());
+	return RAREF_rank(compute_RAREF(matrix)) == matrix.size();
 }
 
+/*
+ * Cast generating matrices of the net to matrices of packed rows checking that they are non-degenerate
+ */
+std::vector<RAREFMatrix> cast_generating_matrices(tms::DigitalNet const &net)
+{
+	std::vector<RAREFMatrix>    genMat;
+	RAREFMatrix                 curr_matrix;
+	for (tms::BasicInt dim_i = 0; dim_i < net.s(); dim_i++)
+	{
+		curr_matrix = cast_matrix(net.generating_matrix(dim_i));
+		if (det(curr_matrix))
+			genMat.push_back(curr_matrix);
+		else
+			throw std::invalid_argument("Computation of tms::analysis::t is only possible for nets with non-degenerate generating matrices.");
+	}
+	return genMat;
+}
 
 
 
@@ -546,18 +616,106 @@ bool det(RAREFMatrix matrix)
 
 tms::BasicInt tms::analysis::t(DigitalNet const &net)
 {
-	std::vector<RAREFMatrix>    genMat;
-	RAREFMatrix                 curr_matrix;
-	for (BasicInt dim_i = 0; dim_i < net.s(); dim_i++)
+	std::vector<RAREFMatrix> const genMat = cast_generating_matrices(net);
+	return net.m() - static_cast<BasicInt>(find_rho_inner(net.m(), net.s(), net.s(), genMat));
+}
+
+tms::analysis::TProjections tms::analysis::t_projections(DigitalNet const &net, BasicInt max_order)
+{
+	if (max_order < 1 || max_order > net.s())
+		throw std::invalid_argument("Order of projections must be from 1 to the dimension of the net.");
+	std::vector<RAREFMatrix> const genMat    = cast_generating_matrices(net);
+	auto const                     binomials = binomial_table(net.s(), max_order);
+
+	std::vector<std::vector<size_t>> rho(max_order);
+	rho[0].assign(net.s(), net.m());
+	for (size_t u = 2; u <= max_order; u++)
 	{
-		curr_matrix = cast_matrix(net.generating_matrix(dim_i));
-		if (det(curr_matrix))
-			genMat.push_back(curr_matrix);
-		else
-			throw std::invalid_argument("Computation of tms::analysis::t is only possible for nets with non-degenerate generating matrices.");
+		generate_projections_exactly(net.s(), u, genMat, binomials, rho);
+	}
+
+	TProjections res;
+	res.s = net.s();
+	res.values.resize(max_order);
+	for (BasicInt u = 0; u < max_order; u++)
+	{
+		res.values[u].reserve(rho[u].size());
+		for (size_t projection_rho : rho[u])
+		{
+			res.values[u].push_back(net.m() - static_cast<BasicInt>(projection_rho));
+		}
+	}
+	return res;
+}
+
+
+
+
+
+// Projections table
+
+
+
+
+
+tms::BasicInt tms::analysis::TProjections::max_order(void) const
+{
+	return static_cast<BasicInt>(values.size());
+}
+
+tms::CountInt tms::analysis::TProjections::index(std::vector<BasicInt> const &coordinates) const
+{
+	if (coordinates.empty() || coordinates.size() > values.size())
+		throw std::out_of_range("\nWrong order of projection\n");
+	CountInt res = 0;
+	for (size_t i = 0; i < coordinates.size(); i++)
+	{
+		if (coordinates[i] >= s || (i != 0 && coordinates[i] <= coordinates[i - 1]))
+			throw std::out_of_range("\nCoordinates of projection must be ascending and less than dimension\n");
+		res += binomial_coefficient(coordinates[i], i + 1);
+	}
+	return res;
+}
+
+std::vector<tms::BasicInt> tms::analysis::TProjections::coordinates(BasicInt order, CountInt index) const
+{
+	if (order < 1 || order > values.size() || index >= values[order - 1].size())
+		throw std::out_of_range("\nWrong projection\n");
+	std::vector<BasicInt> res(order);
+	for (BasicInt i = order; i-- > 0; )
+	{
+		BasicInt c = i;
+		while (binomial_coefficient(c + 1, i + 1) <= index)
+		{
+			++c;
+		}
+		res[i] = c;
+		index -= binomial_coefficient(c, i + 1);
+	}
+	return res;
+}
+
+tms::BasicInt tms::analysis::TProjections::t(std::vector<BasicInt> const &coordinates) const
+{
+	CountInt const projection_i = index(coordinates);
+	return values[coordinates.size() - 1][projection_i];
+}
+
+tms::BasicInt tms::analysis::TProjections::max_t(BasicInt order) const
+{
+	if (order < 1 || order > values.size())
+		throw std::out_of_range("\nWrong order of projection\n");
+	return *std::max_element(values[order - 1].begin(), values[order - 1].end());
+}
+
+tms::Real tms::analysis::TProjections::mean_t(BasicInt order) const
+{
+	if (order < 1 || order > values.size())
+		throw std::out_of_range("\nWrong order of projection\n");
+	Real sum = 0;
+	for (BasicInt value : values[order - 1])
+	{
+		sum += value;
 	}
-	Composition rho = find_rho_inner(net.m(), net.s(), net.s(), genMat);
-	if (rho.size() != 1)
-		throw std::runtime_error("Was not able to calculate t.");
-	return net.m() - rho[0];
+	return sum/values[order - 1].size();
 }
@@ -0,0 +1,432 @@
+#include "../../include/tms-nets/details/bitpoly.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
+#include "../../include/tms-nets/details/simd.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <stdexcept>
+
+
+namespace
+{
+
+	/// Xors words of src shifted to the higher powers by shift bits into dst of dst_count words
+	void xor_shifted(uint64_t *dst, std::size_t dst_count, uint64_t const *src, std::size_t src_count, uintmax_t shift)
+	{
+		std::size_t const  word_shift = static_cast<std::size_t>(shift/64);
+		unsigned int const bit_shift  = static_cast<unsigned int>(shift % 64);
+		for (std::size_t i = 0; i < src_count && i + word_shift < dst_count; ++i)
+		{
+			dst[i + word_shift] ^= src[i] << bit_shift;
+			if ( bit_shift != 0 && i + word_shift + 1 < dst_count )
+			{
+				dst[i + word_shift + 1] ^= src[i] >> (64 - bit_shift);
+			}
+		}
+	}
+
+	/// Returns power of the lowest nonzero coefficient of nonzero polynomial
+	uintmax_t lowest_power(tms::BitPoly const &poly)
+	{
+		std::vector<uint64_t> const &words = poly.words();
+		std::size_t word_i = 0;
+		while ( words[word_i] == 0 )
+		{
+			++word_i;
+		}
+		return 64*word_i + tms::bitops::count_trailing_zeros(words[word_i]);
+	}
+
+	/// Binary GCD of single-word polynomials
+	uint64_t gcd_word(uint64_t a, uint64_t b)
+	{
+		if ( a == 0 || b == 0 )
+		{
+			return a | b;
+		}
+		unsigned int const shift = tms::bitops::count_trailing_zeros(a | b);
+		a >>= tms::bitops::count_trailing_zeros(a);
+		while ( b != 0 )
+		{
+			b >>= tms::bitops::count_trailing_zeros(b);
+			if ( tms::bitops::highest_bit(a) > tms::bitops::highest_bit(b) )
+			{
+				std::swap(a, b);
+			}
+			// both polynomials have unit constant term, so it vanishes
+			b ^= a;
+		}
+		return a << shift;
+	}
+
+	/// Inserts zero bit after each bit of the 32-bit number, i.e. squares the polynomial over GF(2)
+	uint64_t spread_bits(uint64_t word)
+	{
+		word = (word | (word << 16)) & 0x0000FFFF0000FFFFULL;
+		word = (word | (word << 8))  & 0x00FF00FF00FF00FFULL;
+		word = (word | (word << 4))  & 0x0F0F0F0F0F0F0F0FULL;
+		word = (word | (word << 2))  & 0x3333333333333333ULL;
+		word = (word | (word << 1))  & 0x5555555555555555ULL;
+		return word;
+	}
+
+	/// Returns square of the residue modulo polynomial of degree deg < 64
+	uint64_t square_mod_word(uint64_t residue, uint64_t modulus, unsigned int deg)
+	{
+		uint64_t lo = spread_bits(residue & 0xFFFFFFFFULL);
+		uint64_t hi = spread_bits(residue >> 32);
+		for (unsigned int power = 2*deg - 2; power >= deg; --power)
+		{
+			uint64_t const bit = power < 64 ? (lo >> power) & 1 : (hi >> (power - 64)) & 1;
+			if ( bit != 0 )
+			{
+				unsigned int const shift = power - deg;
+				lo ^= modulus << shift;
+				hi ^= shift != 0 ? modulus >> (64 - shift) : 0;
+			}
+		}
+		return lo;
+	}
+
+}
+
+
+namespace tms
+{
+
+	BitPoly::BitPoly(void) :
+	    m_words()
+	{}
+
+	BitPoly::BitPoly(uint64_t coeffs_number) :
+	    m_words()
+	{
+		if ( coeffs_number != 0 )
+		{
+			m_words.push_back(coeffs_number);
+		}
+	}
+
+	BitPoly::BitPoly(std::vector<uintmax_t> const &coeffs) :
+	    m_words((coeffs.size() + 63)/64, 0)
+	{
+		for (std::size_t i = 0; i < coeffs.size(); ++i)
+		{
+			m_words[i/64] |= static_cast<uint64_t>(coeffs[i] & 1) << (i % 64);
+		}
+		normalize();
+	}
+
+	BitPoly
+	BitPoly::from_words(std::vector<uint64_t> words)
+	{
+		BitPoly poly;
+		poly.m_words = std::move(words);
+		poly.normalize();
+		return poly;
+	}
+
+	uintmax_t
+	BitPoly::size(void) const
+	{
+		return m_words.empty() ? 0 : 64*(m_words.size() - 1) + bitops::highest_bit(m_words.back()) + 1;
+	}
+
+	uintmax_t
+	BitPoly::degree(void) const
+	{
+		if ( m_words.empty() )
+		{
+			throw std::logic_error("\nDegree is undefined for zero polynomial\n");
+		}
+		return size() - 1;
+	}
+
+	BitPoly&
+	BitPoly::operator ^=(BitPoly const &r)
+	{
+		if ( m_words.size() < r.m_words.size() )
+		{
+			m_words.resize(r.m_words.size(), 0);
+		}
+		for (std::size_t i = 0; i < r.m_words.size(); ++i)
+		{
+			m_words[i] ^= r.m_words[i];
+		}
+		normalize();
+
+		return *this;
+	}
+
+	BitPoly&
+	BitPoly::operator +=(BitPoly const &r)
+	{
+		return *this ^= r;
+	}
+
+	BitPoly&
+	BitPoly::operator *=(BitPoly const &r)
+	{
+		return *this = *this * r;
+	}
+
+	BitPoly&
+	BitPoly::operator /=(BitPoly const &r)
+	{
+		return *this = divide(*this, r).first;
+	}
+
+	BitPoly&
+	BitPoly::operator %=(BitPoly const &r)
+	{
+		return *this = divide(*this, r).second;
+	}
+
+	BitPoly&
+	BitPoly::operator <<=(uintmax_t shift)
+	{
+		if ( m_words.empty() || shift == 0 )
+		{
+			return *this;
+		}
+		std::vector<uint64_t> shifted(m_words.size() + shift/64 + 1, 0);
+		xor_shifted(shifted.data(), shifted.size(), m_words.data(), m_words.size(), shift);
+		m_words = std::move(shifted);
+		normalize();
+
+		return *this;
+	}
+
+	BitPoly&
+	BitPoly::operator >>=(uintmax_t shift)
+	{
+		std::size_t const  word_shift = static_cast<std::size_t>(std::min<uintmax_t>(shift/64, m_words.size()));
+		unsigned int const bit_shift  = static_cast<unsigned int>(shift % 64);
+		m_words.erase(m_words.begin(), m_words.begin() + word_shift);
+		if ( bit_shift != 0 )
+		{
+			for (std::size_t i = 0; i < m_words.size(); ++i)
+			{
+				m_words[i] >>= bit_shift;
+				if ( i + 1 < m_words.size() )
+				{
+					m_words[i] |= m_words[i + 1] << (64 - bit_shift);
+				}
+			}
+		}
+		normalize();
+
+		return *this;
+	}
+
+	void
+	BitPoly::normalize(void)
+	{
+		while ( !m_words.empty() && m_words.back() == 0 )
+		{
+			m_words.pop_back();
+		}
+	}
+
+
+	BitPoly
+	operator ^ (BitPoly l, BitPoly const &r)
+	{
+		return l ^= r;
+	}
+
+	BitPoly
+	operator + (BitPoly l, BitPoly const &r)
+	{
+		return l ^= r;
+	}
+
+	BitPoly
+	operator * (BitPoly const &l, BitPoly const &r)
+	{
+		if ( l.is_zero() || r.is_zero() )
+		{
+			return BitPoly();
+		}
+		std::vector<uint64_t> product(l.words().size() + r.words().size());
+		simd::clmul(product.data(), l.words().data(), l.words().size(), r.words().data(), r.words().size());
+		return BitPoly::from_words(std::move(product));
+	}
+
+	BitPoly
+	operator / (BitPoly const &l, BitPoly const &r)
+	{
+		return divide(l, r).first;
+	}
+
+	BitPoly
+	operator % (BitPoly const &l, BitPoly const &r)
+	{
+		return divide(l, r).second;
+	}
+
+	BitPoly
+	operator <<(BitPoly l, uintmax_t shift)
+	{
+		return l <<= shift;
+	}
+
+	BitPoly
+	operator >>(BitPoly l, uintmax_t shift)
+	{
+		return l >>= shift;
+	}
+
+	bool
+	operator ==(BitPoly const &l, BitPoly const &r)
+	{
+		return l.m_words == r.m_words;
+	}
+
+	bool
+	operator !=(BitPoly const &l, BitPoly const &r)
+	{
+		return !(l == r);
+	}
+
+
+	std::pair<BitPoly, BitPoly>
+	divide(BitPoly const &dividend, BitPoly const &divisor)
+	{
+		if ( divisor.is_zero() )
+		{
+			throw std::logic_error("\nDivision by zero polynomial\n");
+		}
+		if ( dividend.size() < divisor.size() )
+		{
+			return std::make_pair(BitPoly(), dividend);
+		}
+
+		uintmax_t const dividend_degree = dividend.degree();
+		uintmax_t const divisor_degree  = divisor.degree();
+
+		std::vector<uint64_t>        remainder = dividend.words();
+		std::vector<uint64_t>        quotient((dividend_degree - divisor_degree)/64 + 1, 0);
+		std::vector<uint64_t> const &divisor_words = divisor.words();
+
+		for (uintmax_t power = dividend_degree + 1; power-- > divisor_degree; )
+		{
+			if ( (remainder[power/64] >> (power % 64)) & 1 )
+			{
+				uintmax_t const shift = power - divisor_degree;
+				xor_shifted(remainder.data(), remainder.size(), divisor_words.data(), divisor_words.size(), shift);
+				quotient[shift/64] |= 1ULL << (shift % 64);
+			}
+		}
+
+		return std::make_pair(BitPoly::from_words(std::move(quotient)), BitPoly::from_words(std::move(remainder)));
+	}
+
+	BitPoly
+	gcd(BitPoly a, BitPoly b)
+	{
+		if ( a.is_zero() || b.is_zero() )
+		{
+			return a.is_zero() ? b : a;
+		}
+		if ( a.words().size() == 1 && b.words().size() == 1 )
+		{
+			return BitPoly(gcd_word(a.words()[0], b.words()[0]));
+		}
+
+		uintmax_t const shift = std::min(lowest_power(a), lowest_power(b));
+		a >>= lowest_power(a);
+		while ( !b.is_zero() )
+		{
+			b >>= lowest_power(b);
+			if ( a.size() > b.size() )
+			{
+				std::swap(a, b);
+			}
+			// both polynomials have unit constant term, so it vanishes
+			b ^= a;
+		}
+		return a << shift;
+	}
+
+	bool
+	is_irreducible(BitPoly const &poly)
+	{
+		if ( poly.size() < 2 )
+		{
+			return false;
+		}
+		uintmax_t const deg = poly.degree();
+		if ( deg == 1 )
+		{
+			return true;
+		}
+		if ( poly[0] == 0 )
+		{
+			return false;
+		}
+
+		if ( deg < 64 )
+		{
+			return is_irreducible_word(poly.words()[0]);
+		}
+
+		// Ben-Or's test: poly has no factors of degree i iff gcd(x^(2^i) - x, poly) = 1
+
+		BitPoly const unit_poly(1);
+		BitPoly const x_poly(2);
+		BitPoly       residue = x_poly;
+		for (uintmax_t i = 1; i <= deg/2; ++i)
+		{
+			residue = (residue * residue) % poly;
+			if ( gcd(residue + x_poly, poly) != unit_poly )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	bool
+	is_irreducible_word(uint64_t coeffs_number)
+	{
+		if ( coeffs_number < 2 )
+		{
+			return false;
+		}
+		unsigned int const deg = bitops::highest_bit(coeffs_number);
+		if ( deg == 1 )
+		{
+			return true;
+		}
+		if ( (coeffs_number & 1) == 0 )
+		{
+			return false;
+		}
+
+		// Ben-Or's test: poly has no factors of degree i iff gcd(x^(2^i) - x, poly) = 1
+		uint64_t residue = 2;
+		for (unsigned int i = 1; i <= deg/2; ++i)
+		{
+			residue = square_mod_word(residue, coeffs_number, deg);
+			if ( gcd_word(residue ^ 2, coeffs_number) != 1 )
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	std::ostream&
+	operator <<(std::ostream &out, BitPoly const &poly)
+	{
+		out << "{ ";
+		for (uintmax_t i = 0; i < poly.size(); ++i)
+		{
+			out << (i != 0 ? ", " : "") << poly[i];
+		}
+		out << " }";
+		return out;
+	}
+
+}
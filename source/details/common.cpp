@@ -1,4 +1,56 @@
 #include "../../include/tms-nets/details/common.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
+#include "../../include/tms-nets/details/genmat.hpp"
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <utility>
+
+
+namespace
+{
+	
+	/// Size of groups of M4RMTable for a single product or inversion of matrices: the table is used m times, so it is kept small
+	tms::BasicInt const sc_single_product_group_size = 4;
+	
+	/** Replaces every vector by the sum of the words selected by its bits, the k-th word is selected by
+	 *  the (size - 1 - k)-th bit. Sparse vectors add words one by one, dense ones are multiplied with M4RMTable:
+	 *  building the table and looking it up takes about \f$2^g m/g + m^2/g\f$ operations for groups of g bits,
+	 *  while adding words one by one takes one operation per set bit. */
+	void sum_selected(uint64_t *vectors, uint64_t const *words, tms::BasicInt size)
+	{
+		tms::BasicInt const group_size = sc_single_product_group_size;
+		
+		uint64_t set_bits = 0;
+		for (tms::BasicInt i = 0; i < size; ++i)
+		{
+			set_bits += tms::bitops::count_ones(vectors[i]);
+		}
+		
+		if ( set_bits > ((1ULL << group_size)*size + static_cast<uint64_t>(size)*size)/group_size )
+		{
+			tms::genmat::M4RMTable const table(words, size, group_size);
+			for (tms::BasicInt i = 0; i < size; ++i)
+			{
+				vectors[i] = table(vectors[i]);
+			}
+		}
+		else
+		{
+			for (tms::BasicInt i = 0; i < size; ++i)
+			{
+				uint64_t sum = 0;
+				for (uint64_t bits = vectors[i]; bits != 0; bits &= bits - 1)
+				{
+					sum ^= words[size - 1 - tms::bitops::count_trailing_zeros(bits)];
+				}
+				vectors[i] = sum;
+			}
+		}
+	}
+	
+}
 
 
 namespace tms
@@ -6,7 +58,11 @@ namespace tms
 	
 	// class GenNum
 	
-	GenNum::GenNum(void) = default;
+	GenNum::GenNum(void) :
+	    m_nbits(0)
+	{
+	}
+	
 	GenNum::GenNum(GenNum const&) = default;
 	GenNum::GenNum(GenNum &&)  = default;
 	
@@ -38,13 +94,18 @@ namespace tms
 	
 	GenNum::operator GenMat(void) const
 	{
-		GenMat gamma_matrix(m_nbits);
+		// generating numbers are the columns of the matrix, so the rows are obtained with a bit transposition
+		uint64_t block[64] = {};
 		for (BasicInt j = 0; j < m_nbits; ++j)
 		{
-			for (BasicInt k = 0; k < m_nbits; ++k)
-			{
-				gamma_matrix[j][k] = this->get_bit(j, k);
-			}
+			block[m_nbits - 1 - j] = m_numbers[j];
+		}
+		bitops::transpose(block);
+		
+		GenMat gamma_matrix(m_nbits);
+		for (BasicInt i = 0; i < m_nbits; ++i)
+		{
+			gamma_matrix[i] = GenMatRow::from_bits(m_nbits, block[m_nbits - 1 - i]);
 		}
 		
 		return gamma_matrix;
@@ -53,8 +114,9 @@ namespace tms
 	bool
 	GenNum::is_toeplitz(void) const
 	{	
+		uintmax_t const mask = m_nbits >= max_nbits ? ~uintmax_t(0) : (uintmax_t(1) << m_nbits) - 1;
 		BasicInt i = m_numbers.empty() ? 0 : m_nbits - 1;
-		while ( i > 0 && ((m_numbers[i] << 1) & ((1 << m_nbits) - 1)) == m_numbers[i - 1] )
+		while ( i > 0 && ((m_numbers[i] << 1) & mask) == m_numbers[i - 1] )
 		{
 			--i;
 		}
@@ -65,15 +127,15 @@ namespace tms
 	GenNum&
 	GenNum::operator *=(GenNum const &l)
 	{
-		GenNum c = *this;
-		*this = GenNum(m_nbits);
-		for (BasicInt j = 0; j < m_nbits; ++j)
+		if ( l.m_nbits != m_nbits )
 		{
-			for (BasicInt i = 0; i < m_nbits; ++i)
-			{
-				m_numbers[j] ^= c.m_numbers[i] * l.get_bit(i, j);
-			}
+			throw std::length_error("\nArguments sizes mismatching\n");
 		}
+		// the j-th column of the product is the sum of the columns of *this selected by the bits of the j-th column of l
+		uint64_t columns[max_nbits];
+		std::copy(m_numbers.begin(), m_numbers.end(), columns);
+		std::copy(l.m_numbers.begin(), l.m_numbers.end(), m_numbers.begin());
+		sum_selected(m_numbers.data(), columns, m_nbits);
 		
 		return *this;
 	}
@@ -115,7 +177,8 @@ namespace tms
 	
 	
 	GenMatRow::GenMatRow(BasicInt size) :
-	    m_values(std::vector<uint8_t>(size > max_nbits ? 0 : size))
+	    m_size(size > max_nbits ? 0 : size),
+	    m_bits(0)
 	{
 		if ( size > max_nbits )
 		{
@@ -124,11 +187,11 @@ namespace tms
 	}
 	
 	GenMatRow::GenMatRow(std::vector<uint8_t> const &values_vector) :
-	    m_values(values_vector)
+	    GenMatRow(static_cast<BasicInt>(values_vector.size()))
 	{
-		if ( values_vector.size() > max_nbits )
+		for (BasicInt n = 0; n < m_size; ++n)
 		{
-			throw std::length_error("\nGenMatRow can't hold more than " + std::to_string(max_nbits) + " elements\n");
+			m_bits |= static_cast<uint64_t>(values_vector[n] & 1) << (m_size - 1 - n);
 		}
 	}
 	
@@ -136,17 +199,21 @@ namespace tms
 	    GenMatRow(std::vector<uint8_t>(values_list))
 	{}
 	
+	GenMatRow
+	GenMatRow::from_bits(BasicInt size, uint64_t bits)
+	{
+		GenMatRow row(size);
+		row.m_bits = bits & mask(size);
+		return row;
+	}
+	
 	
 	GenMatRow&
 	GenMatRow::operator ^=(GenMatRow const &r)
 	{
-		if ( m_values.size() == r.size() )
+		if ( m_size == r.m_size )
 		{
-			for (BasicInt i = 0; i < m_values.size(); ++i)
-			{
-				m_values[i] ^= r[i];
-				m_values[i] &= 1;
-			}
+			m_bits ^= r.m_bits;
 			
 			return *this;
 		}
@@ -159,10 +226,8 @@ namespace tms
 	GenMatRow&
 	GenMatRow::operator >>=(BasicInt s)
 	{
-		BasicInt const size = static_cast<BasicInt>(m_values.size());
-		s = std::min(s, size);
-		std::move(m_values.data(), m_values.data() + size - s, m_values.data() + s);
-		std::fill(m_values.data(), m_values.data() + s, 0);
+		// elements are moved to higher indices, i.e. to lower bits
+		m_bits = s >= m_size ? 0 : m_bits >> s;
 		
 		return *this;
 	}
@@ -170,10 +235,7 @@ namespace tms
 	GenMatRow&
 	GenMatRow::operator <<=(BasicInt s)
 	{
-		BasicInt const size = static_cast<BasicInt>(m_values.size());
-		s = std::min(s, size);
-		std::move(m_values.data() + s, m_values.data() + size, m_values.data());
-		std::fill(m_values.data() + size - s, m_values.data() + size, 0);
+		m_bits = s >= m_size ? 0 : (m_bits << s) & mask(m_size);
 		
 		return *this;
 	}
@@ -181,11 +243,7 @@ namespace tms
 	GenMatRow&
 	GenMatRow::operator *=(bool m)
 	{
-		uint8_t n = static_cast<uint8_t>(m);
-		for (uint8_t &value : m_values)
-		{
-			value &= n;
-		}
+		m_bits = m ? m_bits : 0;
 		
 		return *this;
 	}
@@ -196,7 +254,7 @@ namespace tms
 	{
 		if ( l.size() == r.size() )
 		{
-			return l.m_values == r.m_values;
+			return l.m_bits == r.m_bits;
 		}
 		else
 		{
@@ -240,7 +298,11 @@ namespace tms
 	
 	// class GenMat
 	
-	GenMat::GenMat(void) = default;
+	GenMat::GenMat(void) :
+	    m_nbits(0)
+	{
+	}
+	
 	GenMat::GenMat(GenMat const&) = default;
 	GenMat::GenMat(GenMat &&)     = default;
 	
@@ -276,13 +338,17 @@ namespace tms
 	
 	GenMat::operator GenNum(void) const
 	{
+		uint64_t block[64] = {};
+		for (BasicInt i = 0; i < m_nbits; ++i)
+		{
+			block[m_nbits - 1 - i] = m_rows[i].m_bits;
+		}
+		bitops::transpose(block);
+		
 		GenNum gen_num(m_nbits);
 		for (BasicInt j = 0; j < m_nbits; ++j)
 		{
-			for (BasicInt i = 0; i < m_nbits; ++i)
-			{
-				gen_num.set_bit(i, j, m_rows[i][j] & 1);
-			}
+			gen_num[j] = block[m_nbits - 1 - j];
 		}
 		
 		return gen_num;
@@ -292,81 +358,132 @@ namespace tms
 	bool
 	GenMat::is_toeplitz(void) const
 	{
+		// the i-th row must be the first one shifted by i elements, its first i elements are arbitrary
 		BasicInt i = 1;
 		while ( i < m_nbits && \
-			   std::equal(m_rows[0].m_values.data(),
-						  m_rows[0].m_values.data() + m_nbits - i,
-						  m_rows[i].m_values.data() + i) )
+			   (m_rows[i].m_bits & GenMatRow::mask(m_nbits - i)) == (m_rows[0].m_bits >> i) )
 		{
 			++i;
 		}
 		
-		return i == m_nbits;
+		return m_nbits != 0 && i == m_nbits;
 	}
 	
 	GenMat
 	GenMat::inverse(void) const
 	{
-		GenMat matrix = *this;
+		BasicInt const group_size = sc_single_product_group_size;
 		
-		GenMat ident = GenMat(m_nbits);
+		std::vector<uint64_t> matrix(m_nbits);
+		std::vector<uint64_t> ident(m_nbits);
 		for (BasicInt i = 0; i < m_nbits; ++i)
 		{
-			ident[i][i] = 1;
+			matrix[i] = m_rows[i].m_bits;
+			ident[i]  = 1ULL << (m_nbits - 1 - i);
 		}
 		
-		//gauss down:
-		for (BasicInt base_i = 0; base_i < m_nbits; ++base_i)
+		std::vector<uint64_t> matrix_sums(1ULL << group_size);
+		std::vector<uint64_t> ident_sums(1ULL << group_size);
+		
+		// Gauss-Jordan elimination by the Method of Four Russians: pivots of a group of columns are found and reduced
+		// against each other, then all other rows are reduced with one lookup into the sums of the pivot rows
+		for (BasicInt base_i = 0; base_i < m_nbits; base_i += group_size)
 		{
-			BasicInt row_i = base_i;
+			BasicInt const width = std::min(group_size, m_nbits - base_i);
+			BasicInt const shift = m_nbits - base_i - width;
 			
-			while ( matrix[row_i][base_i] == 0 )
+			for (BasicInt pivot_i = base_i; pivot_i < base_i + width; ++pivot_i)
 			{
-				++row_i;
+				uint64_t const pivot = 1ULL << (m_nbits - 1 - pivot_i);
+				
+				// rows below are reduced by the previous pivots of the group only while they are checked
+				BasicInt row_i = pivot_i;
+				uint64_t reduced_matrix = 0;
+				uint64_t reduced_ident  = 0;
+				for (; row_i < m_nbits; ++row_i)
+				{
+					reduced_matrix = matrix[row_i];
+					reduced_ident  = ident[row_i];
+					for (BasicInt prev_i = base_i; prev_i < pivot_i; ++prev_i)
+					{
+						if ( (matrix[row_i] >> (m_nbits - 1 - prev_i)) & 1 )
+						{
+							reduced_matrix ^= matrix[prev_i];
+							reduced_ident  ^= ident[prev_i];
+						}
+					}
+					if ( (reduced_matrix & pivot) != 0 )
+					{
+						break;
+					}
+				}
+				if ( row_i == m_nbits )
+				{
+					throw std::logic_error("\nMatrix is singular\n");
+				}
+				matrix[row_i] = matrix[pivot_i];
+				ident[row_i]  = ident[pivot_i];
+				matrix[pivot_i] = reduced_matrix;
+				ident[pivot_i]  = reduced_ident;
+				
+				for (BasicInt prev_i = base_i; prev_i < pivot_i; ++prev_i)
+				{
+					if ( (matrix[prev_i] & pivot) != 0 )
+					{
+						matrix[prev_i] ^= matrix[pivot_i];
+						ident[prev_i]  ^= ident[pivot_i];
+					}
+				}
 			}
-			std::swap(matrix[row_i], matrix[base_i]);
-			std::swap( ident[row_i],  ident[base_i]);
 			
-			for (row_i = base_i + 1; row_i < m_nbits; ++row_i)
+			// pivot rows are the identity on the columns of the group, so adding the sum of the pivot rows selected
+			// by these columns of a row clears them
+			for (uint64_t subset = 1; subset < (1ULL << width); ++subset)
+			{
+				BasicInt const pivot_i = base_i + width - 1 - bitops::count_trailing_zeros(subset);
+				matrix_sums[subset] = matrix_sums[subset & (subset - 1)] ^ matrix[pivot_i];
+				ident_sums[subset]  = ident_sums[subset & (subset - 1)]  ^ ident[pivot_i];
+			}
+			for (BasicInt row_i = 0; row_i < m_nbits; ++row_i)
 			{
-				if ( matrix[row_i][base_i] != 0 )
+				if ( row_i < base_i || row_i >= base_i + width )
 				{
-					matrix[row_i] ^= matrix[base_i];
-					ident[row_i] ^=  ident[base_i];
+					uint64_t const subset = (matrix[row_i] >> shift) & ((1ULL << width) - 1);
+					matrix[row_i] ^= matrix_sums[subset];
+					ident[row_i]  ^= ident_sums[subset];
 				}
 			}
 		}
 		
-		//gauss up:
-		for (BasicInt base_i = m_nbits - 1; base_i > 0; --base_i)
+		GenMat inversed(m_nbits);
+		for (BasicInt i = 0; i < m_nbits; ++i)
 		{
-			for (BasicInt row_i = 0; row_i < base_i; ++row_i)
-			{
-				if ( matrix[row_i][base_i] != 0 )
-				{
-					ident[row_i] ^= ident[base_i];
-				}
-			}
+			inversed.m_rows[i].m_bits = ident[i];
 		}
 		
-		return ident;
+		return inversed;
 	}
 	
 	
 	GenMat&
 	GenMat::operator *=(GenMat const &r)
 	{
-		GenMat c = *this;
-		*this = GenMat(m_nbits);
+		if ( r.m_nbits != m_nbits )
+		{
+			throw std::length_error("\nArguments sizes mismatching\n");
+		}
+		// the i-th row of the product is the sum of the rows of r selected by the i-th row of *this
+		uint64_t words[max_nbits];
+		uint64_t product[max_nbits];
+		for (BasicInt k = 0; k < m_nbits; ++k)
+		{
+			words[k]   = r.m_rows[k].m_bits;
+			product[k] = m_rows[k].m_bits;
+		}
+		sum_selected(product, words, m_nbits);
 		for (BasicInt i = 0; i < m_nbits; ++i)
 		{
-			for (BasicInt j = 0; j < m_nbits; ++j)
-			{
-				for (BasicInt k = 0; k < m_nbits; ++k)
-				{
-					(*this)[i][j] ^= c[i][k] & r[k][j];
-				}
-			}
+			m_rows[i].m_bits = product[i];
 		}
 		
 		return *this;
@@ -0,0 +1,266 @@
+#include "../../include/tms-nets/details/eigen.hpp"
+#include "../../include/tms-nets/details/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+
+
+
+
+namespace
+{
+	
+	/// Lowest amount of rows of a trailing submatrix which updates are split among threads
+	std::size_t const  sc_parallel_min_size = 256;
+	
+	/// Highest amount of QL iterations per eigenvalue
+	unsigned int const sc_max_iterations    = 64;
+	
+	
+	/** Calls task(row_i) for every row from \f$[begin, end)\f$, on several threads if there are many rows
+	 *  @param [in] begin, end - range of rows
+	 *  @param [in] task - function to call for a row */
+	void for_each_row(std::size_t begin, std::size_t end, std::function<void (std::size_t)> const &task)
+	{
+		if ( end - begin < sc_parallel_min_size )
+		{
+			for (std::size_t row_i = begin; row_i < end; ++row_i)
+			{
+				task(row_i);
+			}
+			return;
+		}
+		std::size_t const chunks_count = 4*tms::parallel::ThreadPool::global().size();
+		std::size_t const chunk_size   = (end - begin + chunks_count - 1)/chunks_count;
+		tms::parallel::for_each_index(chunks_count, [&](std::size_t chunk_i) {
+			std::size_t const chunk_end = std::min(end, begin + (chunk_i + 1)*chunk_size);
+			for (std::size_t row_i = begin + chunk_i*chunk_size; row_i < chunk_end; ++row_i)
+			{
+				task(row_i);
+			}
+		});
+	}
+	
+	/** Householder reflection \f$H = I - \beta v v^T\f$ taking a column below the subdiagonal to a multiple
+	 *  of the first basis vector
+	 *  @param [in] matrix - elements of the matrix in row-major order
+	 *  @param [in] size - amount of rows
+	 *  @param [in] k - column, the reflection acts on rows from k + 1
+	 *  @param [out] v - vector of the reflection, its elements from k + 1 are set
+	 *  @param [out] alpha - the subdiagonal element after the reflection
+	 *  @return \f$\beta\f$, it is zero if the column is zero already */
+	double make_reflection(std::vector<double> const &matrix, std::size_t size, std::size_t k, std::vector<double> &v, double &alpha)
+	{
+		double norm = 0;
+		for (std::size_t i = k + 1; i < size; ++i)
+		{
+			v[i]  = matrix[i*size + k];
+			norm += v[i]*v[i];
+		}
+		norm = std::sqrt(norm);
+		if ( norm == 0 )
+		{
+			alpha = 0;
+			return 0;
+		}
+		// v = x - alpha e_1 with alpha of the opposite sign to x_1 to avoid cancellation, beta = 2/(v^T v)
+		alpha     = v[k + 1] > 0 ? -norm : norm;
+		v[k + 1] -= alpha;
+		return 1/(norm*(norm + std::abs(matrix[(k + 1)*size + k])));
+	}
+	
+	/** Reduces a symmetric matrix to a tridiagonal one with the same eigenvalues by Householder reflections.
+	 *  The k-th reflection zeroes the k-th column below the subdiagonal and is applied from both sides as
+	 *  a symmetric rank-2 update \f$A - v w^T - w v^T\f$ of the trailing submatrix, where \f$w = p - \frac{\beta
+	 *  p^T v}{2} v\f$ for \f$p = \beta A v\f$. The next column is updated ahead of the rest, so the next reflection
+	 *  is known before the update and the product \f$A v\f$ for it is accumulated by the same pass over the rows.
+	 *  @param [in] matrix - elements of the matrix in row-major order, they are overwritten
+	 *  @param [in] size - amount of rows
+	 *  @param [out] diagonal - diagonal of the tridiagonal matrix
+	 *  @param [out] subdiagonal - subdiagonal of the tridiagonal matrix, its i-th element is at the (i + 1)-th row
+	 *                             and the i-th column, the last element is zero */
+	void tridiagonalize(std::vector<double> &matrix, std::size_t size, std::vector<double> &diagonal, std::vector<double> &subdiagonal)
+	{
+		diagonal.assign(size, 0);
+		subdiagonal.assign(size, 0);
+		if ( size == 0 )
+		{
+			return;
+		}
+		std::vector<double> v(size);
+		std::vector<double> w(size);
+		std::vector<double> next_v(size);
+		std::vector<double> next_w(size);
+		double              alpha = 0;
+		double              beta  = size > 2 ? make_reflection(matrix, size, 0, v, alpha) : 0;
+		if ( beta != 0 )
+		{
+			for_each_row(1, size, [&](std::size_t i) {
+				double const *const row = matrix.data() + i*size;
+				double              sum = 0;
+				for (std::size_t j = 1; j < size; ++j)
+				{
+					sum += row[j]*v[j];
+				}
+				w[i] = beta*sum;
+			});
+		}
+		for (std::size_t k = 0; k + 2 < size; ++k)
+		{
+			diagonal[k]    = matrix[k*size + k];
+			subdiagonal[k] = beta != 0 ? alpha : matrix[(k + 1)*size + k];
+			
+			if ( beta != 0 )
+			{
+				double dot = 0;
+				for (std::size_t i = k + 1; i < size; ++i)
+				{
+					dot += w[i]*v[i];
+				}
+				double const scale = beta*dot/2;
+				for (std::size_t i = k + 1; i < size; ++i)
+				{
+					w[i] -= scale*v[i];
+				}
+				// the next column is updated first, the rest of it is updated along with the rows
+				std::size_t const next = k + 1;
+				for (std::size_t i = next; i < size; ++i)
+				{
+					matrix[i*size + next] -= v[i]*w[next] + w[i]*v[next];
+				}
+			}
+			
+			double       next_alpha = 0;
+			double const next_beta  = k + 3 < size ? make_reflection(matrix, size, k + 1, next_v, next_alpha) : 0;
+			for_each_row(k + 1, size, [&](std::size_t i) {
+				double *const row = matrix.data() + i*size;
+				double const  v_i = v[i];
+				double const  w_i = w[i];
+				double        sum = 0;
+				if ( beta != 0 )
+				{
+					for (std::size_t j = k + 2; j < size; ++j)
+					{
+						row[j] -= v_i*w[j] + w_i*v[j];
+						sum    += row[j]*next_v[j];
+					}
+				}
+				else
+				{
+					for (std::size_t j = k + 2; j < size; ++j)
+					{
+						sum += row[j]*next_v[j];
+					}
+				}
+				next_w[i] = next_beta*sum;
+			});
+			
+			v.swap(next_v);
+			w.swap(next_w);
+			alpha = next_alpha;
+			beta  = next_beta;
+		}
+		if ( size >= 2 )
+		{
+			diagonal[size - 2]    = matrix[(size - 2)*size + size - 2];
+			subdiagonal[size - 2] = matrix[(size - 1)*size + size - 2];
+		}
+		diagonal[size - 1] = matrix[size*size - 1];
+	}
+	
+	/** Finds eigenvalues of a symmetric tridiagonal matrix by the implicit QL algorithm with Wilkinson's shifts
+	 *  @param [in,out] diagonal - diagonal of the matrix, replaced with its eigenvalues
+	 *  @param [in] subdiagonal - subdiagonal of the matrix as returned by tridiagonalize, it is overwritten */
+	void tridiagonal_eigenvalues(std::vector<double> &diagonal, std::vector<double> &subdiagonal)
+	{
+		std::size_t const size    = diagonal.size();
+		double const      epsilon = std::numeric_limits<double>::epsilon();
+		for (std::size_t l = 0; l < size; ++l)
+		{
+			unsigned int iterations = 0;
+			std::size_t  split;
+			do
+			{
+				// the matrix splits at the first negligible subdiagonal element
+				for (split = l; split + 1 < size; ++split)
+				{
+					double const around = std::abs(diagonal[split]) + std::abs(diagonal[split + 1]);
+					if ( std::abs(subdiagonal[split]) <= epsilon*around )
+					{
+						break;
+					}
+				}
+				if ( split == l )
+				{
+					break;
+				}
+				if ( ++iterations > sc_max_iterations )
+				{
+					throw std::runtime_error("\nEigenvalues didn't converge\n");
+				}
+				double g = (diagonal[l + 1] - diagonal[l])/(2*subdiagonal[l]);
+				double r = std::hypot(g, 1.0);
+				g = diagonal[split] - diagonal[l] + subdiagonal[l]/(g + std::copysign(r, g));
+				double s = 1;
+				double c = 1;
+				double p = 0;
+				bool   deflated = false;
+				for (std::size_t i = split; i-- > l; )
+				{
+					double const f = s*subdiagonal[i];
+					double const b = c*subdiagonal[i];
+					r = std::hypot(f, g);
+					subdiagonal[i + 1] = r;
+					if ( r == 0 )
+					{
+						// underflow, the rotation is skipped and the iteration is restarted
+						diagonal[i + 1]    -= p;
+						subdiagonal[split]  = 0;
+						deflated            = true;
+						break;
+					}
+					s = f/r;
+					c = g/r;
+					g = diagonal[i + 1] - p;
+					r = (diagonal[i] - g)*s + 2*c*b;
+					p = s*r;
+					diagonal[i + 1] = g + p;
+					g = c*r - b;
+				}
+				if ( deflated )
+				{
+					continue;
+				}
+				diagonal[l]       -= p;
+				subdiagonal[l]     = g;
+				subdiagonal[split] = 0;
+			} while ( true );
+		}
+	}
+	
+}
+
+
+
+
+
+std::vector<double>
+tms::eigen::symmetric_eigenvalues(std::vector<double> matrix, std::size_t size)
+{
+	if ( matrix.size() != size*size )
+	{
+		throw std::length_error("\nMatrix must have size*size elements\n");
+	}
+	
+	std::vector<double> diagonal;
+	std::vector<double> subdiagonal;
+	tridiagonalize(matrix, size, diagonal, subdiagonal);
+	tridiagonal_eigenvalues(diagonal, subdiagonal);
+	std::sort(diagonal.begin(), diagonal.end(), std::greater<double>());
+	
+	return diagonal;
+}
@@ -1,4 +1,8 @@
 #include "../../include/tms-nets/details/genmat.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
+
+#include <string>
+
 
 
 
@@ -42,3 +46,91 @@ tms::genmat::make_psi(GenMat const &a, GenMat const &b)
 		throw std::length_error("\n");
 	}
 }
+
+
+tms::genmat::M4RMTable::M4RMTable(uint64_t const *words, BasicInt size, BasicInt group_size) :
+    m_group_size(group_size),
+    m_groups(group_size == 0 ? 0 : (size + group_size - 1)/group_size),
+    m_sums(static_cast<std::size_t>(m_groups) << group_size, 0)
+{
+	if ( group_size == 0 || group_size > max_group_size )
+	{
+		throw std::logic_error("\nSize of groups of M4RMTable must be from 1 to " + std::to_string(max_group_size) + "\n");
+	}
+	
+	for (BasicInt group_i = 0; group_i < m_groups; ++group_i)
+	{
+		BasicInt const  first_bit = group_i*group_size;
+		uint64_t       *sums      = m_sums.data() + (static_cast<std::size_t>(group_i) << group_size);
+		// the sum of a subset is the sum of the subset without its lowest word plus that word;
+		// the b-th bit of a vector selects the (size - 1 - b)-th word, bits starting from size select nothing
+		for (uint64_t subset = 1; subset < (1ULL << group_size); ++subset)
+		{
+			BasicInt const bit = first_bit + bitops::count_trailing_zeros(subset);
+			sums[subset] = sums[subset & (subset - 1)] ^ (bit < size ? words[size - 1 - bit] : 0);
+		}
+	}
+}
+
+
+std::vector<tms::GenNum>
+tms::genmat::multiply_left(GenMat const &left, std::vector<GenNum> const &generating_numbers)
+{
+	BasicInt const         size = left.size();
+	GenNum const           columns(left);
+	std::vector<uint64_t> words(size);
+	for (BasicInt k = 0; k < size; ++k)
+	{
+		words[k] = columns[k];
+	}
+	// the j-th column of a product is the sum of the columns of left selected by the j-th column of the right factor
+	M4RMTable const table(words.data(), size);
+	
+	std::vector<GenNum> products;
+	products.reserve(generating_numbers.size());
+	for (GenNum const &numbers : generating_numbers)
+	{
+		if ( numbers.size() != size )
+		{
+			throw std::length_error("\nArguments sizes mismatching\n");
+		}
+		products.emplace_back(size);
+		for (BasicInt j = 0; j < size; ++j)
+		{
+			products.back()[j] = table(numbers[j]);
+		}
+	}
+	
+	return products;
+}
+
+std::vector<tms::GenNum>
+tms::genmat::multiply_right(std::vector<GenNum> const &generating_numbers, GenMat const &right)
+{
+	BasicInt const         size = right.size();
+	std::vector<uint64_t> words(size);
+	for (BasicInt k = 0; k < size; ++k)
+	{
+		words[k] = right[k].bits();
+	}
+	// the i-th row of a product is the sum of the rows of right selected by the i-th row of the left factor
+	M4RMTable const table(words.data(), size);
+	
+	std::vector<GenNum> products;
+	products.reserve(generating_numbers.size());
+	for (GenNum const &numbers : generating_numbers)
+	{
+		if ( numbers.size() != size )
+		{
+			throw std::length_error("\nArguments sizes mismatching\n");
+		}
+		GenMat rows(numbers);
+		for (BasicInt i = 0; i < size; ++i)
+		{
+			rows[i] = GenMatRow::from_bits(size, table(rows[i].bits()));
+		}
+		products.emplace_back(rows);
+	}
+	
+	return products;
+}
@@ -1,138 +1,57 @@
 #include "../../include/tms-nets/details/gf2poly.hpp"
+#include "../../include/tms-nets/details/parallel.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 
 
 
 
-irrpoly::gfpoly
+
+tms::Polynomial
 tms::gf2poly::make_gf2poly(std::vector<uintmax_t> const &coeffs)
 {
-	static irrpoly::gf const sc_gf2 = irrpoly::make_gf(2);
-	
-	return irrpoly::gfpoly(sc_gf2, coeffs);
+	return Polynomial(coeffs);
 }
 
-std::vector<irrpoly::gfpoly>
+std::vector<tms::Polynomial>
 tms::gf2poly::generate_irrpolys(unsigned int const amount,
 					unsigned int const max_defect)
 {
-	std::vector<irrpoly::gfpoly> irrpolys;
-	
-	if ( amount == 0 )
-	{ return irrpolys; }
-	
-	irrpolys.reserve(amount);
-	irrpolys.emplace_back(make_gf2poly({0, 1}));
-	
-	auto number_to_poly = [&](uintmax_t coeffs_number) -> irrpoly::gfpoly {
-		std::vector<uintmax_t> coeffs;
-		unsigned int degree = 0;
-		while ( coeffs_number >> degree != 0 ) { ++degree; }
-		coeffs.reserve(degree--);
-		for (unsigned int i = 0; i <= degree; ++i)
-		{
-			coeffs.emplace_back((coeffs_number >> i) & 1);
-		}
-		return make_gf2poly(coeffs);
-	};
-
-	uintmax_t coeffs_number = 3;
-	unsigned int defect = 0;
-	
-	while ( irrpolys.size() < amount && defect <= max_defect )
-	{
-		irrpolys.emplace_back(number_to_poly(coeffs_number));
-		
-		while ( !is_irreducible_berlekamp(irrpolys.back()) )
-		{
-			coeffs_number += 2;
-			irrpolys.back() = number_to_poly(coeffs_number);
-		}
-		coeffs_number += 2;
-		defect += irrpolys.back().size() - 2;
-	}
+	std::vector<uint64_t> const  masks = first_irreducible_masks(amount, max_defect);
+	std::vector<tms::Polynomial> irrpolys;
 	
-	if ( defect > max_defect )
+	irrpolys.reserve(masks.size());
+	for (uint64_t mask : masks)
 	{
-		irrpolys.pop_back();
+		irrpolys.emplace_back(mask);
 	}
 	
 	return irrpolys;
 }
 
-std::vector<irrpoly::gfpoly>
+std::vector<tms::Polynomial>
 tms::gf2poly::generate_irrpolys_in_parallel(unsigned int const amount,
 								unsigned int const max_defect)
 {
-	std::vector<irrpoly::gfpoly> irrpolys;
-	
-	if (amount == 0) { return irrpolys; }
-	irrpolys.reserve(amount);
-	irrpolys.emplace_back( make_gf2poly({0, 1}) );
-	if (amount == 1) { return irrpolys; }
-	
-	irrpoly::multithread::polychecker ch;
-	
-	// function that generates polynomials for check
-	auto input = [&]() -> irrpoly::gfpoly {
-		static uintmax_t index = 1;
-		uint8_t degree = 0;
-		for (uint8_t i = 1; index >> i; ++i, ++degree);
-		std::vector<uintmax_t> res;
-		res.reserve(degree + 2);
-		res.emplace_back(1);
-		for (uint8_t i = 0; i <= degree; ++i) {
-			res.emplace_back((index & (1ull << i)) ? 1 : 0);
-		}
-		++index;
-		return make_gf2poly(res);
-	};
+	std::vector<uint64_t> const  masks = first_irreducible_masks(amount, max_defect, true);
+	std::vector<tms::Polynomial> irrpolys;
 	
-	auto check = irrpoly::multithread::make_check_func(irrpoly::multithread::irreducible_method::berlekamp,
-														irrpoly::multithread::primitive_method::nil);
-	
-	unsigned int defect = 0;
-	
-	unsigned int count = amount - 1;
-	auto callback = [&](const irrpoly::gfpoly &poly, const typename irrpoly::multithread::check_result &result) -> bool {
-		if ( result.irreducible ) {
-			irrpolys.emplace_back(poly);
-			defect += poly.size() - 2;
-			--count;
-		}
-		return count == 0 || defect >= max_defect;
-	};
-	
-	// The last argument `false` says that we want to collect all results of checks started
-	// by default this argument is equal to `true` and after `callback` returns `true`
-	// all results are discarded. Here we need all results for proper sequence.
-	ch.chain(input, check, callback, false);
-	
-	// sorting polynomial in lexicographic order
-	std::sort(irrpolys.begin(), irrpolys.end(),
-				[](const irrpoly::gfpoly &a, const irrpoly::gfpoly &b) {
-					if (a.degree() == b.degree()) {
-						for (auto i = a.degree(); i > 0; --i) {
-							if (a[i] != b[i]) {
-								return a[i] < b[i];
-							}
-						}
-						return a[0] < b[0];
-					}
-					return a.degree() < b.degree();
-				});
-	// discarding unnecessary elements
-	while ( irrpolys.size() > amount || defect > max_defect )
+	irrpolys.reserve(masks.size());
+	for (uint64_t mask : masks)
 	{
-		defect -= irrpolys.back().size() - 2;
-		irrpolys.pop_back();
+		irrpolys.emplace_back(mask);
 	}
 	
 	return irrpolys;
 }
 
 // RESTRICTIONS: degrees must be <= 63
-std::vector<irrpoly::gfpoly>
+std::vector<tms::Polynomial>
 tms::gf2poly::generate_irrpolys_with_degrees(std::vector<unsigned int> const &degrees,
 								unsigned int const max_defect)
 {
@@ -140,7 +59,7 @@ tms::gf2poly::generate_irrpolys_with_degrees(std::vector<unsigned int> const &de
 	// counter of possible t values for (t,m,s)-nets with sush irred. polynomials degrees.
 	unsigned int defect = 0;
 	
-	std::vector<irrpoly::gfpoly> irrpolys;
+	std::vector<tms::Polynomial> irrpolys;
 
 	if ( amount == 0 ) { return irrpolys; }
 	
@@ -161,32 +80,21 @@ tms::gf2poly::generate_irrpolys_with_degrees(std::vector<unsigned int> const &de
 	// "Brute-force" generation of irreducible polynomials:
 	irrpolys.reserve(amount);
 	
-	auto number_to_poly = [&](uintmax_t coeffs_number) -> irrpoly::gfpoly {
-		std::vector<uintmax_t> coeffs;
-		unsigned int degree = 0;
-		while ( coeffs_number >> degree != 0 ) { ++degree; }
-		coeffs.reserve(degree--);
-		for (unsigned int j = 0; j <= degree; ++j)
-		{
-			coeffs.emplace_back((coeffs_number >> j) & 1);
-		}
-		return make_gf2poly(coeffs);
-	};
 	
 	i = 0;
 	while ( i < amount && (coeffs_numbers[degrees[i]] & (2ULL << degrees[i]) - 1) >= 2 )
 	{
 		uintmax_t cur_coeffs_number = coeffs_numbers[degrees[i]];
-		irrpolys.emplace_back( number_to_poly(cur_coeffs_number) );
+		irrpolys.emplace_back( Polynomial(cur_coeffs_number) );
 		
 		// generating polynomials of chosen degree until:
 		//  1. coeddicient number exceeds
 		//  2. irreducible polynomial generated
 		while ( (cur_coeffs_number & (2ULL << degrees[i]) - 1) > 2 &&
-				!is_irreducible_berlekamp(irrpolys.back()) )
+				!is_irreducible(irrpolys.back()) )
 		{
 			cur_coeffs_number = coeffs_numbers[degrees[i]] += 2;
-			irrpolys.back() = number_to_poly(cur_coeffs_number);
+			irrpolys.back() = Polynomial(cur_coeffs_number);
 		}
 		// this increments by 1 only in one case - when occurs the first polynomial of degree 1
 		coeffs_numbers[degrees[i]] += (cur_coeffs_number != 2) + 1;
@@ -196,47 +104,338 @@ tms::gf2poly::generate_irrpolys_with_degrees(std::vector<unsigned int> const &de
 	return irrpolys;
 }
 
-std::vector<irrpoly::gfpoly>
+std::vector<tms::Polynomial>
 tms::gf2poly::generate_irrpolys_until_degree(unsigned int const degree)
 {
-	std::vector<irrpoly::gfpoly> irrpolys;
+	std::vector<tms::Polynomial> irrpolys;
 	
 	if ( degree < 2 )
 	{ return irrpolys; }
 	
-	//irrpolys.reserve(amount);
-	irrpolys.emplace_back(make_gf2poly({0, 1}));
+	for (uint64_t mask : irreducible_masks(std::min(degree - 1, 63U)))
+	{
+		irrpolys.emplace_back(mask);
+	}
 	
-	auto number_to_poly = [&](uintmax_t coeffs_number) -> irrpoly::gfpoly {
-		std::vector<uintmax_t> coeffs;
-		unsigned int degree = 0;
-		while ( coeffs_number >> degree != 0 ) { ++degree; }
-		coeffs.reserve(degree--);
-		for (unsigned int i = 0; i <= degree; ++i)
+	return irrpolys;
+}
+
+
+namespace
+{
+	
+	/// Cache of the sieved polynomials of degrees <= sieve_max_degree, lists are never changed after insertion
+	std::mutex                                           sc_sieve_mutex;
+	std::map< unsigned int, std::vector<uint64_t> >      sc_sieved_masks;
+	
+	/// Lowest degree which sieve is split into parallel tasks, lower degrees take less time than scheduling
+	unsigned int const sc_parallel_sieve_min_degree = 16;
+	/// Amount of cofactors a task of the parallel sieve multiplies a factor by
+	uint64_t const     sc_sieve_range_size          = 1ULL << 14;
+	/// Amount of coefficient numbers a task checks with Ben-Or's test
+	uint64_t const     sc_scan_range_size           = 1ULL << 13;
+	
+	/// Returns product of polynomials which product has degree less than 64
+	uint64_t multiply_words(uint64_t a, uint64_t b)
+	{
+		uint64_t product = 0;
+		for (; a != 0; a &= a - 1)
 		{
-			coeffs.emplace_back((coeffs_number >> i) & 1);
+			product ^= b << tms::bitops::count_trailing_zeros(a);
 		}
-		return make_gf2poly(coeffs);
-	};
+		return product;
+	}
 	
-	uintmax_t coeffs_number = 3, upper_lim = 1ULL << degree;
+	/** Appends coefficient numbers of the polynomials that are not marked as composite: the n-th bit of
+	 *  composite corresponds to the polynomial first + n.
+	 *  @param [in] composite - bits of polynomials, read with load_word(word_i)
+	 *  @param [in] words_begin, words_end - range of words to read */
+	template <typename LoadWord>
+	void collect_unmarked(std::vector<uint64_t> &masks, uint64_t first, std::size_t words_begin, std::size_t words_end,
+						  LoadWord const &load_word)
+	{
+		for (std::size_t word_i = words_begin; word_i < words_end; ++word_i)
+		{
+			uint64_t unmarked = ~load_word(word_i);
+			// polynomials of degrees less than 6 don't fill the word
+			if ( first < 64 )
+			{
+				unmarked &= (1ULL << first) - 1;
+			}
+			for (; unmarked != 0; unmarked &= unmarked - 1)
+			{
+				masks.push_back(first + 64*word_i + tms::bitops::count_trailing_zeros(unmarked));
+			}
+		}
+	}
 	
-	while ( coeffs_number < upper_lim )
+	/** Sieves irreducible polynomials of the degree out of all polynomials of the degree: every product of
+	 *  an irreducible polynomial p of degree k <= degree/2 by a polynomial q of degree (degree - k) is marked.
+	 *  q runs over Gray's code, so the next product differs from the previous one by a shift of p. */
+	std::vector<uint64_t> sieve_masks_of_degree(unsigned int degree)
 	{
-		irrpolys.emplace_back(number_to_poly(coeffs_number));
+		uint64_t const        first = 1ULL << degree;
+		std::vector<uint64_t> composite(std::max<uint64_t>(first/64, 1), 0);
 		
-		while ( coeffs_number < upper_lim && !is_irreducible_berlekamp(irrpolys.back()) )
+		for (unsigned int factor_degree = 1; factor_degree <= degree/2; ++factor_degree)
 		{
-			coeffs_number += 2;
-			irrpolys.back() = number_to_poly(coeffs_number);
+			uint64_t const cofactors_count = 1ULL << (degree - factor_degree);
+			for (uint64_t factor : tms::gf2poly::irreducible_masks_of_degree(factor_degree))
+			{
+				uint64_t product = factor << (degree - factor_degree);
+				composite[(product - first)/64] |= 1ULL << ((product - first) % 64);
+				for (uint64_t cofactor_i = 1; cofactor_i < cofactors_count; ++cofactor_i)
+				{
+					product ^= factor << tms::bitops::count_trailing_zeros(cofactor_i);
+					composite[(product - first)/64] |= 1ULL << ((product - first) % 64);
+				}
+			}
 		}
-		coeffs_number += 2;
+		
+		std::vector<uint64_t> masks;
+		collect_unmarked(masks, first, 0, composite.size(), [&](std::size_t word_i) { return composite[word_i]; });
+		return masks;
 	}
 	
-	if ( !is_irreducible_berlekamp(irrpolys.back()) )
+	/** The same sieve split into tasks: a task multiplies one factor by a disjoint range of cofactors, its Gray's code
+	 *  walk starts from the product with the cofactor at the beginning of the range. Marks are set with atomic OR,
+	 *  so tasks share one bitset without locks; marking is idempotent, hence the result doesn't depend on the order. */
+	std::vector<uint64_t> sieve_masks_of_degree_in_parallel(unsigned int degree)
 	{
-		irrpolys.pop_back();
+		struct Range
+		{
+			uint64_t     factor;
+			unsigned int cofactor_degree;
+			uint64_t     cofactor_begin;
+			uint64_t     cofactor_end;
+		};
+		
+		uint64_t const    first = 1ULL << degree;
+		std::vector<Range> ranges;
+		for (unsigned int factor_degree = 1; factor_degree <= degree/2; ++factor_degree)
+		{
+			uint64_t const cofactors_count = 1ULL << (degree - factor_degree);
+			for (uint64_t factor : tms::gf2poly::irreducible_masks_of_degree(factor_degree))
+			{
+				for (uint64_t cofactor_i = 0; cofactor_i < cofactors_count; cofactor_i += sc_sieve_range_size)
+				{
+					ranges.push_back({factor, degree - factor_degree, cofactor_i,
+									  std::min(cofactor_i + sc_sieve_range_size, cofactors_count)});
+				}
+			}
+		}
+		
+		std::size_t const                           words_count = first/64;
+		std::unique_ptr< std::atomic<uint64_t>[] > const composite(new std::atomic<uint64_t>[words_count]());
+		auto const mark = [&](uint64_t product) {
+			composite[(product - first)/64].fetch_or(1ULL << ((product - first) % 64), std::memory_order_relaxed);
+		};
+		
+		tms::parallel::for_each_index(ranges.size(), [&](std::size_t range_i) {
+			Range const &range = ranges[range_i];
+			// the cofactor_i-th cofactor is x^cofactor_degree plus Gray's code of cofactor_i
+			uint64_t const gray_code = range.cofactor_begin ^ (range.cofactor_begin >> 1);
+			uint64_t       product   = multiply_words(range.factor, (1ULL << range.cofactor_degree) ^ gray_code);
+			mark(product);
+			for (uint64_t cofactor_i = range.cofactor_begin + 1; cofactor_i < range.cofactor_end; ++cofactor_i)
+			{
+				product ^= range.factor << tms::bitops::count_trailing_zeros(cofactor_i);
+				mark(product);
+			}
+		});
+		
+		// words are collected by chunks and the chunks are concatenated in their order
+		std::size_t const                  chunk_words = sc_sieve_range_size/64;
+		std::vector< std::vector<uint64_t> > found((words_count + chunk_words - 1)/chunk_words);
+		tms::parallel::for_each_index(found.size(), [&](std::size_t chunk_i) {
+			collect_unmarked(found[chunk_i], first, chunk_i*chunk_words, std::min((chunk_i + 1)*chunk_words, words_count),
+							 [&](std::size_t word_i) { return composite[word_i].load(std::memory_order_relaxed); });
+		});
+		
+		std::vector<uint64_t> masks;
+		for (std::vector<uint64_t> const &chunk : found)
+		{
+			masks.insert(masks.end(), chunk.begin(), chunk.end());
+		}
+		return masks;
 	}
 	
-	return irrpolys;
+	/// Returns reference to the cached list of the sieved polynomials of the degree
+	std::vector<uint64_t> const &sieved_masks_of_degree(unsigned int degree, bool in_parallel)
+	{
+		{
+			std::lock_guard<std::mutex> lock(sc_sieve_mutex);
+			auto const found = sc_sieved_masks.find(degree);
+			if ( found != sc_sieved_masks.end() )
+			{
+				return found->second;
+			}
+		}
+		// the lock is not held while sieving, because lower degrees are requested recursively;
+		// if several threads sieve the same degree, the list of the first one is kept
+		// atomic marks are slower than plain ones, so a single thread sieves serially
+		bool const            split = in_parallel && degree >= sc_parallel_sieve_min_degree &&
+									  tms::parallel::ThreadPool::global().size() > 1;
+		std::vector<uint64_t> masks = split ? sieve_masks_of_degree_in_parallel(degree) : sieve_masks_of_degree(degree);
+		std::lock_guard<std::mutex> lock(sc_sieve_mutex);
+		return sc_sieved_masks.emplace(degree, std::move(masks)).first->second;
+	}
+	
+	/** Passes irreducible polynomials of the degree to accept in ascending order while it returns true, polynomials
+	 *  are checked with Ben-Or's test. In parallel coefficient numbers are split into disjoint ranges, which are
+	 *  checked in waves of 4 ranges per thread; polynomials found in every range are kept apart and passed in the
+	 *  order of the ranges, so the result is the same as the serial one.
+	 *  @return false if accept returned false */
+	bool scan_masks_of_degree(unsigned int degree, bool in_parallel, std::function<bool (uint64_t)> const &accept)
+	{
+		uint64_t const first = (1ULL << degree) + 1;
+		uint64_t const last  = (2ULL << degree) - 1;
+		
+		if ( !in_parallel )
+		{
+			for (uint64_t coeffs_number = first; coeffs_number <= last; coeffs_number += 2)
+			{
+				if ( tms::is_irreducible_word(coeffs_number) && !accept(coeffs_number) )
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+		
+		std::size_t const                    wave_ranges = 4*static_cast<std::size_t>(tms::parallel::ThreadPool::global().size());
+		std::vector< std::vector<uint64_t> > found(wave_ranges);
+		for (uint64_t wave_first = first; wave_first <= last; wave_first += wave_ranges*sc_scan_range_size)
+		{
+			tms::parallel::for_each_index(wave_ranges, [&](std::size_t range_i) {
+				found[range_i].clear();
+				uint64_t const range_first = wave_first + range_i*sc_scan_range_size;
+				if ( range_first > last )
+				{
+					return;
+				}
+				uint64_t const range_last = std::min(range_first + sc_scan_range_size - 2, last);
+				for (uint64_t coeffs_number = range_first; coeffs_number <= range_last; coeffs_number += 2)
+				{
+					if ( tms::is_irreducible_word(coeffs_number) )
+					{
+						found[range_i].push_back(coeffs_number);
+					}
+				}
+			});
+			
+			for (std::vector<uint64_t> const &range : found)
+			{
+				for (uint64_t mask : range)
+				{
+					if ( !accept(mask) )
+					{
+						return false;
+					}
+				}
+			}
+			
+			if ( last - wave_first < wave_ranges*sc_scan_range_size )
+			{
+				break;
+			}
+		}
+		return true;
+	}
+	
+	/// Returns irreducible polynomials of the degree from the table, the sieve or Ben-Or's test
+	std::vector<uint64_t> masks_of_degree(unsigned int degree, bool in_parallel)
+	{
+		using namespace tms::gf2poly;
+		
+		if ( degree <= precomputed::max_degree )
+		{
+			uint32_t const *begin = std::lower_bound(precomputed::masks, precomputed::masks + precomputed::count, 1U << degree);
+			uint32_t const *end   = std::lower_bound(begin, precomputed::masks + precomputed::count, 2U << degree);
+			return std::vector<uint64_t>(begin, end);
+		}
+		if ( degree <= sieve_max_degree )
+		{
+			return sieved_masks_of_degree(degree, in_parallel);
+		}
+		
+		std::vector<uint64_t> masks;
+		scan_masks_of_degree(degree, in_parallel, [&](uint64_t mask) { masks.push_back(mask); return true; });
+		return masks;
+	}
+	
+}
+
+std::vector<uint64_t>
+tms::gf2poly::irreducible_masks_of_degree(unsigned int const degree)
+{
+	if ( degree == 0 || degree > 63 )
+	{
+		throw std::logic_error("\nDegree of polynomials must be from 1 to 63\n");
+	}
+	
+	return masks_of_degree(degree, false);
+}
+
+std::vector<uint64_t>
+tms::gf2poly::irreducible_masks(unsigned int const max_degree)
+{
+	std::vector<uint64_t> masks;
+	for (unsigned int degree = 1; degree <= max_degree; ++degree)
+	{
+		std::vector<uint64_t> const masks_of_degree = irreducible_masks_of_degree(degree);
+		masks.insert(masks.end(), masks_of_degree.begin(), masks_of_degree.end());
+	}
+	return masks;
+}
+
+std::vector<uint64_t>
+tms::gf2poly::first_irreducible_masks(unsigned int const amount,
+									  unsigned int const max_defect,
+									  bool         const in_parallel)
+{
+	std::vector<uint64_t> masks;
+	
+	if ( amount == 0 )
+	{ return masks; }
+	
+	masks.reserve(amount);
+	masks.push_back(2);
+	
+	unsigned int defect = 0;
+	unsigned int degree = 1;
+	// adds the next polynomial, returns false when no more polynomials are needed
+	auto accept = [&](uint64_t mask) -> bool {
+		masks.push_back(mask);
+		defect += degree - 1;
+		return masks.size() < amount && defect <= max_defect;
+	};
+	
+	bool needed = masks.size() < amount;
+	for (; needed && degree < 64; ++degree)
+	{
+		if ( degree <= std::max(precomputed::max_degree, sieve_max_degree) )
+		{
+			// x is already added
+			for (uint64_t mask : masks_of_degree(degree, in_parallel))
+			{
+				if ( mask != 2 && !(needed = accept(mask)) )
+				{
+					break;
+				}
+			}
+		}
+		else
+		{
+			// polynomials of high degrees are checked only until enough of them are found
+			needed = scan_masks_of_degree(degree, in_parallel, accept);
+		}
+	}
+	
+	if ( defect > max_defect )
+	{
+		masks.pop_back();
+	}
+	
+	return masks;
 }
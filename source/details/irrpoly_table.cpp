@@ -0,0 +1,241 @@
+/**
+ * @file    irrpoly_table.cpp
+ *
+ * @brief   Precomputed table of all irreducible polynomials over GF(2) with degrees up to 14.
+ *          The table was generated with the sieve of gf2poly::irreducible_masks_of_degree; define TMS_NO_IRRPOLY_TABLE
+ *          to build the library without it, then all polynomials are sieved at runtime.
+ */
+#include "../../include/tms-nets/details/gf2poly.hpp"
+
+
+#ifndef TMS_NO_IRRPOLY_TABLE
+
+unsigned int const tms::gf2poly::precomputed::max_degree = 14;
+
+std::size_t  const tms::gf2poly::precomputed::count      = 2538;
+
+uint32_t     const tms::gf2poly::precomputed::masks[]    =
+{
+	0x0002, 0x0003, 0x0007, 0x000B, 0x000D, 0x0013, 0x0019, 0x001F, 0x0025, 0x0029, 0x002F, 0x0037,
+	0x003B, 0x003D, 0x0043, 0x0049, 0x0057, 0x005B, 0x0061, 0x0067, 0x006D, 0x0073, 0x0075, 0x0083,
+	0x0089, 0x008F, 0x0091, 0x009D, 0x00A7, 0x00AB, 0x00B9, 0x00BF, 0x00C1, 0x00CB, 0x00D3, 0x00D5,
+	0x00E5, 0x00EF, 0x00F1, 0x00F7, 0x00FD, 0x011B, 0x011D, 0x012B, 0x012D, 0x0139, 0x013F, 0x014D,
+	0x015F, 0x0163, 0x0165, 0x0169, 0x0171, 0x0177, 0x017B, 0x0187, 0x018B, 0x018D, 0x019F, 0x01A3,
+	0x01A9, 0x01B1, 0x01BD, 0x01C3, 0x01CF, 0x01D7, 0x01DD, 0x01E7, 0x01F3, 0x01F5, 0x01F9, 0x0203,
+	0x0211, 0x0217, 0x021B, 0x0221, 0x022D, 0x0233, 0x024B, 0x0259, 0x025F, 0x0265, 0x0269, 0x026F,
+	0x0277, 0x027D, 0x0287, 0x0295, 0x0299, 0x02A3, 0x02A5, 0x02AF, 0x02B7, 0x02BD, 0x02CF, 0x02D1,
+	0x02DB, 0x02F5, 0x02F9, 0x0301, 0x0313, 0x0315, 0x031F, 0x0323, 0x0331, 0x033B, 0x0349, 0x034F,
+	0x035B, 0x0361, 0x036B, 0x036D, 0x0373, 0x037F, 0x0385, 0x038F, 0x03A1, 0x03B5, 0x03B9, 0x03C7,
+	0x03CB, 0x03CD, 0x03D5, 0x03D9, 0x03E3, 0x03E9, 0x03FB, 0x0409, 0x040F, 0x041B, 0x041D, 0x0427,
+	0x042D, 0x0435, 0x0447, 0x0453, 0x0463, 0x0465, 0x046F, 0x0481, 0x048B, 0x0499, 0x04A9, 0x04AF,
+	0x04C5, 0x04C9, 0x04D7, 0x04E7, 0x04ED, 0x04F3, 0x04FF, 0x050B, 0x050D, 0x0519, 0x051F, 0x0523,
+	0x0531, 0x053D, 0x0543, 0x0557, 0x0561, 0x0567, 0x056B, 0x0585, 0x058F, 0x0597, 0x059B, 0x05A1,
+	0x05AB, 0x05B9, 0x05C1, 0x05C7, 0x05E5, 0x05F7, 0x05FB, 0x0613, 0x0615, 0x0623, 0x0625, 0x0631,
+	0x0637, 0x0643, 0x064F, 0x0651, 0x065B, 0x0679, 0x067F, 0x0685, 0x0689, 0x06A7, 0x06AD, 0x06B5,
+	0x06BF, 0x06C1, 0x06CD, 0x06D3, 0x06DF, 0x06F7, 0x06FD, 0x070F, 0x0711, 0x0717, 0x071D, 0x0721,
+	0x072B, 0x0735, 0x0739, 0x0747, 0x074D, 0x0755, 0x0759, 0x0763, 0x077B, 0x077D, 0x0781, 0x0787,
+	0x078D, 0x0793, 0x07A9, 0x07B1, 0x07C5, 0x07DB, 0x07EB, 0x07F3, 0x07F9, 0x07FF, 0x0805, 0x0817,
+	0x082B, 0x082D, 0x0847, 0x0863, 0x0865, 0x0871, 0x087B, 0x088D, 0x0895, 0x089F, 0x08A9, 0x08B1,
+	0x08C3, 0x08CF, 0x08D1, 0x08E1, 0x08E7, 0x08EB, 0x08F5, 0x090D, 0x0913, 0x0925, 0x0929, 0x0937,
+	0x093B, 0x093D, 0x0945, 0x0949, 0x0951, 0x095B, 0x0973, 0x0975, 0x097F, 0x0983, 0x098F, 0x09AB,
+	0x09AD, 0x09B9, 0x09C7, 0x09D9, 0x09E5, 0x09EF, 0x09F7, 0x0A01, 0x0A07, 0x0A13, 0x0A15, 0x0A29,
+	0x0A49, 0x0A61, 0x0A6D, 0x0A79, 0x0A7F, 0x0A85, 0x0A91, 0x0A9D, 0x0AA7, 0x0AAB, 0x0AB3, 0x0AB5,
+	0x0AD5, 0x0ADF, 0x0AE3, 0x0AE9, 0x0AEF, 0x0AF1, 0x0AFB, 0x0B03, 0x0B09, 0x0B11, 0x0B33, 0x0B3F,
+	0x0B41, 0x0B4B, 0x0B59, 0x0B5F, 0x0B65, 0x0B6F, 0x0B7D, 0x0B87, 0x0B8B, 0x0B93, 0x0B95, 0x0BAF,
+	0x0BB7, 0x0BBD, 0x0BC9, 0x0BDB, 0x0BDD, 0x0BE7, 0x0BED, 0x0C0B, 0x0C0D, 0x0C19, 0x0C1F, 0x0C31,
+	0x0C57, 0x0C61, 0x0C6B, 0x0C73, 0x0C75, 0x0C85, 0x0C89, 0x0C97, 0x0C9B, 0x0C9D, 0x0CB3, 0x0CBF,
+	0x0CC7, 0x0CCD, 0x0CD3, 0x0CD5, 0x0CE3, 0x0CE9, 0x0CF7, 0x0D03, 0x0D0F, 0x0D1D, 0x0D27, 0x0D2D,
+	0x0D41, 0x0D47, 0x0D55, 0x0D59, 0x0D63, 0x0D6F, 0x0D71, 0x0D93, 0x0D9F, 0x0DA9, 0x0DBB, 0x0DBD,
+	0x0DC9, 0x0DD7, 0x0DDB, 0x0DE1, 0x0DE7, 0x0DF5, 0x0DFF, 0x0E05, 0x0E1D, 0x0E21, 0x0E27, 0x0E2B,
+	0x0E33, 0x0E39, 0x0E47, 0x0E4B, 0x0E55, 0x0E5F, 0x0E71, 0x0E7B, 0x0E7D, 0x0E81, 0x0E93, 0x0E9F,
+	0x0EA3, 0x0EBB, 0x0EC9, 0x0ECF, 0x0EDD, 0x0EF3, 0x0EF9, 0x0F0B, 0x0F19, 0x0F31, 0x0F37, 0x0F5D,
+	0x0F6B, 0x0F6D, 0x0F75, 0x0F79, 0x0F83, 0x0F91, 0x0F97, 0x0F9B, 0x0FA7, 0x0FAD, 0x0FB5, 0x0FCD,
+	0x0FD3, 0x0FE5, 0x0FE9, 0x0FFB, 0x1009, 0x1017, 0x1021, 0x1033, 0x1035, 0x103F, 0x104D, 0x1053,
+	0x1069, 0x1077, 0x107B, 0x107D, 0x1081, 0x108B, 0x1099, 0x10A3, 0x10A5, 0x10CF, 0x10D1, 0x10EB,
+	0x10ED, 0x10FF, 0x1107, 0x111F, 0x1123, 0x1131, 0x1137, 0x113B, 0x114F, 0x1157, 0x1161, 0x116B,
+	0x116D, 0x1179, 0x1183, 0x1185, 0x1191, 0x11AB, 0x11B3, 0x11D9, 0x11DF, 0x11E3, 0x11EF, 0x11F1,
+	0x1201, 0x120D, 0x1213, 0x1219, 0x1225, 0x1237, 0x123B, 0x123D, 0x1243, 0x1245, 0x1267, 0x126D,
+	0x1273, 0x127F, 0x12B5, 0x12B9, 0x12C1, 0x12CB, 0x1309, 0x130F, 0x131B, 0x131D, 0x1321, 0x1333,
+	0x1339, 0x133F, 0x134D, 0x1365, 0x1371, 0x1399, 0x139F, 0x13A3, 0x13A9, 0x13AF, 0x13BB, 0x13C3,
+	0x13D1, 0x13D7, 0x13DD, 0x13F3, 0x13F5, 0x1407, 0x1413, 0x1431, 0x1437, 0x1449, 0x144F, 0x145B,
+	0x145D, 0x1467, 0x146B, 0x1475, 0x147F, 0x1489, 0x14A1, 0x14A7, 0x14AD, 0x14B5, 0x14CD, 0x14D3,
+	0x14D9, 0x14DF, 0x14E5, 0x150F, 0x151D, 0x154B, 0x154D, 0x1581, 0x1593, 0x15A5, 0x15A9, 0x15BB,
+	0x15C5, 0x15D7, 0x15DD, 0x15EB, 0x15F9, 0x1603, 0x1609, 0x161B, 0x163F, 0x1641, 0x1647, 0x164B,
+	0x1655, 0x1659, 0x1663, 0x1665, 0x166F, 0x1693, 0x16A5, 0x16BD, 0x16C3, 0x16C9, 0x16D1, 0x16E1,
+	0x16E7, 0x16F3, 0x16FF, 0x170B, 0x1715, 0x1719, 0x173D, 0x1743, 0x1745, 0x174F, 0x1757, 0x175D,
+	0x1773, 0x1775, 0x1779, 0x1789, 0x178F, 0x1797, 0x179D, 0x17AD, 0x17B3, 0x17BF, 0x17C1, 0x17DF,
+	0x17FB, 0x1807, 0x180D, 0x181F, 0x1823, 0x1831, 0x1837, 0x1849, 0x1857, 0x185D, 0x186D, 0x1879,
+	0x187F, 0x1883, 0x1891, 0x1897, 0x18A1, 0x18B9, 0x18CB, 0x18CD, 0x18EF, 0x18F1, 0x18FB, 0x1905,
+	0x1909, 0x191B, 0x192D, 0x1935, 0x1941, 0x194B, 0x195F, 0x1965, 0x196F, 0x197B, 0x1981, 0x198B,
+	0x1999, 0x19B1, 0x19B7, 0x19BD, 0x19C9, 0x19CF, 0x19DD, 0x19E7, 0x19ED, 0x19F9, 0x1A1B, 0x1A1D,
+	0x1A21, 0x1A2B, 0x1A33, 0x1A4D, 0x1A53, 0x1A55, 0x1A5F, 0x1A63, 0x1A69, 0x1A7B, 0x1A8B, 0x1AB1,
+	0x1AC5, 0x1AD1, 0x1AE1, 0x1AE7, 0x1AEB, 0x1AF5, 0x1B0B, 0x1B0D, 0x1B13, 0x1B19, 0x1B1F, 0x1B2F,
+	0x1B45, 0x1B57, 0x1B89, 0x1B8F, 0x1B91, 0x1BA7, 0x1BB5, 0x1BB9, 0x1BBF, 0x1BC1, 0x1BCB, 0x1BD3,
+	0x1BE3, 0x1BFD, 0x1C03, 0x1C05, 0x1C0F, 0x1C11, 0x1C17, 0x1C27, 0x1C4D, 0x1C5F, 0x1C87, 0x1C9F,
+	0x1CA5, 0x1CB7, 0x1CBB, 0x1CC5, 0x1CC9, 0x1CCF, 0x1CD7, 0x1CEB, 0x1CED, 0x1CF3, 0x1D01, 0x1D07,
+	0x1D23, 0x1D2F, 0x1D3D, 0x1D43, 0x1D51, 0x1D5B, 0x1D5D, 0x1D67, 0x1D75, 0x1D79, 0x1D83, 0x1D85,
+	0x1D89, 0x1D91, 0x1DA7, 0x1DB3, 0x1DC1, 0x1DEF, 0x1E07, 0x1E15, 0x1E19, 0x1E2F, 0x1E3B, 0x1E3D,
+	0x1E45, 0x1E51, 0x1E5D, 0x1E61, 0x1E67, 0x1E73, 0x1E8F, 0x1E97, 0x1E9B, 0x1EB9, 0x1EBF, 0x1ECD,
+	0x1ED3, 0x1EE3, 0x1EF1, 0x1EF7, 0x1F03, 0x1F11, 0x1F1B, 0x1F27, 0x1F39, 0x1F47, 0x1F4B, 0x1F53,
+	0x1F65, 0x1F71, 0x1F7D, 0x1F81, 0x1F8D, 0x1F99, 0x1FAF, 0x1FBB, 0x1FBD, 0x1FC3, 0x1FC5, 0x1FC9,
+	0x1FE1, 0x1FED, 0x1FFF, 0x201B, 0x2027, 0x2035, 0x2053, 0x2065, 0x206F, 0x208B, 0x208D, 0x209F,
+	0x20A5, 0x20AF, 0x20BB, 0x20BD, 0x20C3, 0x20C9, 0x20E1, 0x20F3, 0x210D, 0x2115, 0x2129, 0x212F,
+	0x213B, 0x2143, 0x2167, 0x216B, 0x2179, 0x2189, 0x2197, 0x219D, 0x21BF, 0x21C1, 0x21C7, 0x21CD,
+	0x21DF, 0x21E3, 0x21F1, 0x21FB, 0x2219, 0x2225, 0x2237, 0x223D, 0x2243, 0x225B, 0x225D, 0x2279,
+	0x227F, 0x2289, 0x2297, 0x229B, 0x22B3, 0x22BF, 0x22CD, 0x22EF, 0x22F7, 0x22FB, 0x2305, 0x2327,
+	0x232B, 0x2347, 0x2355, 0x2359, 0x236F, 0x2371, 0x237D, 0x2387, 0x238D, 0x2395, 0x23A3, 0x23A9,
+	0x23B1, 0x23B7, 0x23BB, 0x23E1, 0x23ED, 0x23F9, 0x240B, 0x2413, 0x241F, 0x2425, 0x2429, 0x243D,
+	0x2451, 0x2457, 0x2461, 0x246D, 0x247F, 0x2483, 0x249B, 0x249D, 0x24B5, 0x24BF, 0x24C1, 0x24C7,
+	0x24CB, 0x24E3, 0x2509, 0x2517, 0x251D, 0x2521, 0x252D, 0x2539, 0x2553, 0x2555, 0x2563, 0x2571,
+	0x2577, 0x2587, 0x258B, 0x2595, 0x2599, 0x259F, 0x25AF, 0x25BD, 0x25C5, 0x25CF, 0x25D7, 0x25EB,
+	0x2603, 0x2605, 0x2611, 0x262D, 0x263F, 0x264B, 0x2653, 0x2659, 0x2669, 0x2677, 0x267B, 0x2687,
+	0x2693, 0x2699, 0x26B1, 0x26B7, 0x26BD, 0x26C3, 0x26EB, 0x26F5, 0x2713, 0x2729, 0x273B, 0x274F,
+	0x2757, 0x275D, 0x276B, 0x2773, 0x2779, 0x2783, 0x2791, 0x27A1, 0x27B9, 0x27C7, 0x27CB, 0x27DF,
+	0x27EF, 0x27F1, 0x2807, 0x2819, 0x281F, 0x2823, 0x2831, 0x283B, 0x283D, 0x2845, 0x2867, 0x2875,
+	0x2885, 0x28AB, 0x28AD, 0x28BF, 0x28CD, 0x28D5, 0x28DF, 0x28E3, 0x28E9, 0x28FB, 0x2909, 0x290F,
+	0x2911, 0x291B, 0x292B, 0x2935, 0x293F, 0x2941, 0x294B, 0x2955, 0x2977, 0x297D, 0x2981, 0x2993,
+	0x299F, 0x29AF, 0x29B7, 0x29BD, 0x29C3, 0x29D7, 0x29F3, 0x29F5, 0x2A03, 0x2A0F, 0x2A1D, 0x2A21,
+	0x2A33, 0x2A35, 0x2A4D, 0x2A69, 0x2A6F, 0x2A71, 0x2A7B, 0x2A7D, 0x2AA5, 0x2AA9, 0x2AB1, 0x2AC5,
+	0x2AD7, 0x2ADB, 0x2AEB, 0x2AF3, 0x2B01, 0x2B15, 0x2B23, 0x2B25, 0x2B2F, 0x2B37, 0x2B43, 0x2B49,
+	0x2B6D, 0x2B7F, 0x2B85, 0x2B97, 0x2B9B, 0x2BAD, 0x2BB3, 0x2BD9, 0x2BE5, 0x2BFD, 0x2C0F, 0x2C21,
+	0x2C2B, 0x2C2D, 0x2C3F, 0x2C41, 0x2C4D, 0x2C71, 0x2C8B, 0x2C8D, 0x2C95, 0x2CA3, 0x2CAF, 0x2CBD,
+	0x2CC5, 0x2CD1, 0x2CD7, 0x2CE1, 0x2CE7, 0x2CEB, 0x2D0D, 0x2D19, 0x2D29, 0x2D2F, 0x2D37, 0x2D3B,
+	0x2D45, 0x2D5B, 0x2D67, 0x2D75, 0x2D89, 0x2D8F, 0x2DA7, 0x2DAB, 0x2DB5, 0x2DE3, 0x2DF1, 0x2DFD,
+	0x2E07, 0x2E13, 0x2E15, 0x2E29, 0x2E49, 0x2E4F, 0x2E5B, 0x2E5D, 0x2E61, 0x2E6B, 0x2E8F, 0x2E91,
+	0x2E97, 0x2E9D, 0x2EAB, 0x2EB3, 0x2EB9, 0x2EDF, 0x2EFB, 0x2EFD, 0x2F05, 0x2F09, 0x2F11, 0x2F17,
+	0x2F3F, 0x2F41, 0x2F4B, 0x2F4D, 0x2F59, 0x2F5F, 0x2F65, 0x2F69, 0x2F95, 0x2FA5, 0x2FAF, 0x2FB1,
+	0x2FCF, 0x2FDD, 0x2FE7, 0x2FED, 0x2FF5, 0x2FFF, 0x3007, 0x3015, 0x3019, 0x302F, 0x3049, 0x304F,
+	0x3067, 0x3079, 0x307F, 0x3091, 0x30A1, 0x30B5, 0x30BF, 0x30C1, 0x30D3, 0x30D9, 0x30E5, 0x30EF,
+	0x3105, 0x310F, 0x3135, 0x3147, 0x314D, 0x315F, 0x3163, 0x3171, 0x317B, 0x31A3, 0x31A9, 0x31B7,
+	0x31C5, 0x31C9, 0x31DB, 0x31E1, 0x31EB, 0x31ED, 0x31F3, 0x31FF, 0x3209, 0x320F, 0x321D, 0x3227,
+	0x3239, 0x324B, 0x3253, 0x3259, 0x3265, 0x3281, 0x3293, 0x3299, 0x329F, 0x32A9, 0x32B7, 0x32BB,
+	0x32C3, 0x32D7, 0x32DB, 0x32E7, 0x3307, 0x3315, 0x332F, 0x3351, 0x335D, 0x3375, 0x3397, 0x339B,
+	0x33AB, 0x33B9, 0x33C1, 0x33C7, 0x33D5, 0x33E3, 0x33E5, 0x33F7, 0x33FB, 0x3409, 0x341B, 0x3427,
+	0x3441, 0x344D, 0x345F, 0x3469, 0x3477, 0x347B, 0x3487, 0x3493, 0x3499, 0x34A5, 0x34BD, 0x34C9,
+	0x34DB, 0x34E7, 0x34F9, 0x350D, 0x351F, 0x3525, 0x3531, 0x3537, 0x3545, 0x354F, 0x355D, 0x356D,
+	0x3573, 0x357F, 0x359D, 0x35A1, 0x35B9, 0x35CD, 0x35D5, 0x35D9, 0x35E3, 0x35E9, 0x35EF, 0x3601,
+	0x360B, 0x361F, 0x3625, 0x362F, 0x363B, 0x3649, 0x3651, 0x365B, 0x3673, 0x3675, 0x3691, 0x369B,
+	0x369D, 0x36AD, 0x36CB, 0x36D3, 0x36D5, 0x36E3, 0x36EF, 0x3705, 0x370F, 0x371B, 0x3721, 0x372D,
+	0x3739, 0x3741, 0x3747, 0x3753, 0x3771, 0x3777, 0x378B, 0x3795, 0x3799, 0x37A3, 0x37C5, 0x37CF,
+	0x37D1, 0x37D7, 0x37DD, 0x37E1, 0x37F3, 0x3803, 0x3805, 0x3817, 0x381D, 0x3827, 0x3833, 0x384B,
+	0x3859, 0x3869, 0x3871, 0x38A3, 0x38B1, 0x38BB, 0x38C9, 0x38CF, 0x38E1, 0x38F3, 0x38F9, 0x3901,
+	0x3907, 0x390B, 0x3913, 0x3931, 0x394F, 0x3967, 0x396D, 0x3983, 0x3985, 0x3997, 0x39A1, 0x39A7,
+	0x39AD, 0x39CB, 0x39CD, 0x39D3, 0x39EF, 0x39F7, 0x39FD, 0x3A07, 0x3A29, 0x3A2F, 0x3A3D, 0x3A51,
+	0x3A5D, 0x3A61, 0x3A67, 0x3A73, 0x3A75, 0x3A89, 0x3AB9, 0x3ABF, 0x3ACD, 0x3AD3, 0x3AD5, 0x3ADF,
+	0x3AE5, 0x3AE9, 0x3AFB, 0x3B11, 0x3B2B, 0x3B2D, 0x3B35, 0x3B3F, 0x3B53, 0x3B59, 0x3B63, 0x3B65,
+	0x3B6F, 0x3B71, 0x3B77, 0x3B8B, 0x3B99, 0x3BA5, 0x3BA9, 0x3BB7, 0x3BBB, 0x3BD1, 0x3BE7, 0x3BF3,
+	0x3BFF, 0x3C0D, 0x3C13, 0x3C15, 0x3C1F, 0x3C23, 0x3C25, 0x3C3B, 0x3C4F, 0x3C5D, 0x3C6D, 0x3C83,
+	0x3C8F, 0x3C9D, 0x3CA7, 0x3CAB, 0x3CB9, 0x3CC7, 0x3CE9, 0x3CFB, 0x3CFD, 0x3D03, 0x3D17, 0x3D1B,
+	0x3D21, 0x3D2D, 0x3D33, 0x3D35, 0x3D41, 0x3D4D, 0x3D65, 0x3D69, 0x3D7D, 0x3D81, 0x3D95, 0x3DB1,
+	0x3DB7, 0x3DC3, 0x3DD1, 0x3DDB, 0x3DE7, 0x3DEB, 0x3DF9, 0x3E05, 0x3E09, 0x3E0F, 0x3E1B, 0x3E2B,
+	0x3E3F, 0x3E41, 0x3E53, 0x3E65, 0x3E69, 0x3E8B, 0x3EA3, 0x3EBD, 0x3EC5, 0x3ED7, 0x3EDD, 0x3EE1,
+	0x3EF9, 0x3F0D, 0x3F19, 0x3F1F, 0x3F25, 0x3F37, 0x3F3D, 0x3F43, 0x3F45, 0x3F49, 0x3F51, 0x3F57,
+	0x3F61, 0x3F83, 0x3F89, 0x3F91, 0x3FAB, 0x3FB5, 0x3FE3, 0x3FF7, 0x3FFD, 0x4021, 0x402B, 0x4033,
+	0x4039, 0x403F, 0x4053, 0x405F, 0x4065, 0x407B, 0x4087, 0x40A9, 0x40AF, 0x40BB, 0x40BD, 0x40CF,
+	0x40D7, 0x40EB, 0x40F3, 0x40F9, 0x410B, 0x410D, 0x4113, 0x413B, 0x4143, 0x4149, 0x4157, 0x4167,
+	0x416D, 0x4191, 0x419B, 0x419D, 0x41A7, 0x41AB, 0x41AD, 0x41B5, 0x41D5, 0x41D9, 0x41F1, 0x4201,
+	0x420D, 0x4245, 0x4249, 0x4257, 0x4261, 0x4273, 0x4279, 0x427F, 0x4283, 0x4285, 0x429D, 0x42A1,
+	0x42C7, 0x42CB, 0x42CD, 0x42E3, 0x42E9, 0x42EF, 0x4303, 0x4309, 0x431B, 0x4321, 0x4327, 0x433F,
+	0x4369, 0x437B, 0x437D, 0x4387, 0x4395, 0x43AF, 0x43C9, 0x43DD, 0x43EB, 0x43ED, 0x43FF, 0x440B,
+	0x440D, 0x4443, 0x445D, 0x4473, 0x4489, 0x44C1, 0x44D3, 0x44D5, 0x44DF, 0x44E3, 0x44F1, 0x44FB,
+	0x4503, 0x4509, 0x450F, 0x452B, 0x4539, 0x4559, 0x456F, 0x4577, 0x457D, 0x458D, 0x4599, 0x459F,
+	0x45A5, 0x45B7, 0x45C5, 0x45C9, 0x45D1, 0x45D7, 0x45E7, 0x45F3, 0x45FF, 0x460F, 0x461D, 0x4627,
+	0x4635, 0x4647, 0x4659, 0x4663, 0x4671, 0x467B, 0x468D, 0x4693, 0x4695, 0x46A3, 0x46A5, 0x46C5,
+	0x46CF, 0x46DB, 0x46EB, 0x46FF, 0x4725, 0x4731, 0x4743, 0x474F, 0x477F, 0x4789, 0x4791, 0x479B,
+	0x47A7, 0x47B5, 0x47C1, 0x47D3, 0x47D9, 0x47E5, 0x47E9, 0x47EF, 0x47FD, 0x4813, 0x4819, 0x481F,
+	0x483B, 0x4843, 0x4851, 0x485B, 0x4861, 0x4867, 0x487F, 0x4883, 0x4891, 0x48BF, 0x48C7, 0x48E3,
+	0x48F1, 0x48F7, 0x48FD, 0x491D, 0x4921, 0x492D, 0x4939, 0x4941, 0x4953, 0x495F, 0x4965, 0x4969,
+	0x4977, 0x4987, 0x498B, 0x49A9, 0x49CF, 0x49D1, 0x49DD, 0x49E1, 0x49E7, 0x4A17, 0x4A35, 0x4A59,
+	0x4A65, 0x4A7B, 0x4A81, 0x4A87, 0x4A8B, 0x4A93, 0x4AA3, 0x4AAF, 0x4ABD, 0x4AC9, 0x4ADD, 0x4AED,
+	0x4AF9, 0x4B1F, 0x4B37, 0x4B49, 0x4B5B, 0x4B61, 0x4B6B, 0x4B6D, 0x4B73, 0x4B79, 0x4B85, 0x4B8F,
+	0x4B97, 0x4BA1, 0x4BAB, 0x4BB3, 0x4BB9, 0x4BCB, 0x4BCD, 0x4BD5, 0x4BDF, 0x4BF1, 0x4BFB, 0x4C09,
+	0x4C1B, 0x4C1D, 0x4C27, 0x4C2B, 0x4C3F, 0x4C47, 0x4C4B, 0x4C53, 0x4C55, 0x4C65, 0x4C7D, 0x4C8D,
+	0x4CA5, 0x4CBD, 0x4CC5, 0x4CD1, 0x4CD7, 0x4CED, 0x4CFF, 0x4D15, 0x4D1F, 0x4D29, 0x4D31, 0x4D45,
+	0x4D4F, 0x4D51, 0x4D75, 0x4D85, 0x4D8F, 0x4DAD, 0x4DB3, 0x4DC1, 0x4DD3, 0x4DF1, 0x4DFB, 0x4E01,
+	0x4E15, 0x4E23, 0x4E37, 0x4E43, 0x4E49, 0x4E51, 0x4E6B, 0x4E6D, 0x4E83, 0x4E9B, 0x4EB3, 0x4ED3,
+	0x4EE5, 0x4EE9, 0x4EEF, 0x4F1D, 0x4F21, 0x4F4B, 0x4F55, 0x4F5F, 0x4F69, 0x4F6F, 0x4F81, 0x4F8D,
+	0x4F9F, 0x4FA5, 0x4FA9, 0x4FB7, 0x4FBB, 0x4FD7, 0x4FEB, 0x4FED, 0x4FF9, 0x5007, 0x501F, 0x5025,
+	0x505B, 0x505D, 0x50A1, 0x50CB, 0x50D5, 0x50D9, 0x50E3, 0x50E9, 0x50EF, 0x50FB, 0x511B, 0x5121,
+	0x512D, 0x513F, 0x5153, 0x5159, 0x515F, 0x516F, 0x517D, 0x518B, 0x5199, 0x51A5, 0x51B1, 0x51B7,
+	0x51CF, 0x51D1, 0x51DB, 0x51EB, 0x51ED, 0x51F5, 0x51FF, 0x5205, 0x520F, 0x522D, 0x5265, 0x5271,
+	0x528B, 0x5299, 0x52A3, 0x52B1, 0x52BD, 0x52C3, 0x52C5, 0x52CF, 0x52D1, 0x52E7, 0x52EB, 0x52F9,
+	0x5301, 0x5319, 0x5325, 0x5329, 0x5337, 0x5349, 0x535B, 0x5367, 0x5375, 0x539B, 0x539D, 0x53A7,
+	0x53B9, 0x53BF, 0x53C7, 0x53D3, 0x53E5, 0x53F1, 0x53FD, 0x5403, 0x540F, 0x5417, 0x5435, 0x5439,
+	0x5447, 0x5459, 0x545F, 0x547B, 0x548D, 0x5493, 0x5495, 0x549F, 0x54B1, 0x54B7, 0x54BB, 0x54DD,
+	0x54E1, 0x54EB, 0x5513, 0x5519, 0x552F, 0x5537, 0x5567, 0x556B, 0x5575, 0x5579, 0x557F, 0x5583,
+	0x5585, 0x5591, 0x5597, 0x55AD, 0x55C1, 0x55D3, 0x55DF, 0x55E9, 0x55F7, 0x5607, 0x560D, 0x5615,
+	0x5623, 0x5629, 0x562F, 0x5631, 0x5657, 0x565D, 0x569B, 0x56AB, 0x56AD, 0x56B3, 0x56C1, 0x56C7,
+	0x56CD, 0x56F1, 0x56F7, 0x56FB, 0x572B, 0x572D, 0x573F, 0x574B, 0x5755, 0x5759, 0x5763, 0x5765,
+	0x577D, 0x5793, 0x57AF, 0x57BD, 0x57C3, 0x57C5, 0x57D7, 0x57E7, 0x57F3, 0x5803, 0x5811, 0x5821,
+	0x582D, 0x5833, 0x5835, 0x583F, 0x5841, 0x587D, 0x5887, 0x588B, 0x5895, 0x5899, 0x58A3, 0x58AF,
+	0x58B1, 0x58D1, 0x58DD, 0x58E7, 0x58EB, 0x58F9, 0x58FF, 0x5913, 0x5923, 0x593B, 0x594F, 0x597F,
+	0x598F, 0x5997, 0x599D, 0x59A1, 0x59A7, 0x59AB, 0x59B5, 0x59CB, 0x59DF, 0x59E9, 0x59FD, 0x5A0D,
+	0x5A13, 0x5A1F, 0x5A25, 0x5A3B, 0x5A3D, 0x5A43, 0x5A45, 0x5A49, 0x5A75, 0x5A8F, 0x5AA7, 0x5AB5,
+	0x5AC1, 0x5AD3, 0x5AD5, 0x5AD9, 0x5AF7, 0x5B0F, 0x5B17, 0x5B1D, 0x5B2B, 0x5B33, 0x5B39, 0x5B41,
+	0x5B63, 0x5B69, 0x5B77, 0x5B99, 0x5BA3, 0x5BA9, 0x5BC3, 0x5BC5, 0x5BE1, 0x5BEB, 0x5BF9, 0x5C07,
+	0x5C0B, 0x5C19, 0x5C31, 0x5C37, 0x5C49, 0x5C5D, 0x5C6D, 0x5C79, 0x5C83, 0x5CA1, 0x5CBF, 0x5CC1,
+	0x5CCB, 0x5CCD, 0x5CE5, 0x5D05, 0x5D11, 0x5D1D, 0x5D33, 0x5D35, 0x5D47, 0x5D6F, 0x5D87, 0x5D8D,
+	0x5D95, 0x5D9F, 0x5DA3, 0x5DA9, 0x5DBB, 0x5DC9, 0x5DCF, 0x5DDB, 0x5DE1, 0x5E03, 0x5E0F, 0x5E1B,
+	0x5E2D, 0x5E47, 0x5E4B, 0x5E63, 0x5E7D, 0x5E81, 0x5E99, 0x5EA5, 0x5EA9, 0x5ED7, 0x5EDB, 0x5EE7,
+	0x5EF5, 0x5F07, 0x5F0D, 0x5F19, 0x5F1F, 0x5F23, 0x5F3D, 0x5F43, 0x5F45, 0x5F51, 0x5F61, 0x5F6B,
+	0x5F75, 0x5F89, 0x5F97, 0x5FAB, 0x5FCD, 0x5FDF, 0x5FE3, 0x5FE5, 0x5FF1, 0x600B, 0x600D, 0x6015,
+	0x602F, 0x603D, 0x604F, 0x6051, 0x6061, 0x6067, 0x606B, 0x6089, 0x6097, 0x609D, 0x60A1, 0x60AB,
+	0x60B3, 0x60B9, 0x60D3, 0x60D5, 0x60F7, 0x6109, 0x6111, 0x612D, 0x6139, 0x6141, 0x6153, 0x6171,
+	0x617D, 0x619F, 0x61A5, 0x61AF, 0x61BB, 0x61DB, 0x61ED, 0x61F5, 0x61FF, 0x622B, 0x6233, 0x6235,
+	0x6239, 0x6247, 0x624D, 0x6263, 0x626F, 0x627D, 0x628D, 0x629F, 0x62A5, 0x62A9, 0x62B1, 0x62B7,
+	0x62D7, 0x62DB, 0x62DD, 0x62EB, 0x62ED, 0x62F3, 0x62FF, 0x6323, 0x6331, 0x6337, 0x633D, 0x635B,
+	0x636D, 0x6375, 0x6385, 0x6389, 0x6391, 0x63A1, 0x63BF, 0x63EF, 0x63FD, 0x6409, 0x6417, 0x642D,
+	0x6441, 0x6447, 0x644D, 0x6455, 0x648B, 0x6495, 0x649F, 0x64A9, 0x64B1, 0x64E7, 0x64F5, 0x6501,
+	0x650B, 0x6519, 0x6537, 0x653B, 0x6543, 0x6545, 0x6549, 0x655B, 0x6583, 0x6591, 0x65A7, 0x65AD,
+	0x65B9, 0x65BF, 0x65D3, 0x65D5, 0x65D9, 0x65E5, 0x65EF, 0x65F1, 0x65F7, 0x6601, 0x6607, 0x660D,
+	0x6623, 0x663B, 0x664F, 0x665D, 0x666B, 0x666D, 0x6673, 0x6683, 0x668F, 0x6697, 0x66A7, 0x66AB,
+	0x66B5, 0x66B9, 0x66D9, 0x66DF, 0x66E9, 0x6711, 0x671B, 0x6721, 0x6733, 0x674B, 0x675F, 0x6769,
+	0x6777, 0x6781, 0x67A3, 0x67AF, 0x67B7, 0x67D1, 0x67E7, 0x67EB, 0x67F5, 0x6803, 0x6811, 0x681B,
+	0x681D, 0x682B, 0x6841, 0x6853, 0x686F, 0x6877, 0x688B, 0x688D, 0x6893, 0x689F, 0x68A5, 0x68A9,
+	0x68C5, 0x68C9, 0x68FF, 0x6907, 0x6919, 0x692F, 0x693D, 0x6957, 0x696B, 0x6973, 0x6975, 0x6979,
+	0x6985, 0x698F, 0x699B, 0x699D, 0x69A1, 0x69AB, 0x69C7, 0x69CD, 0x69E9, 0x6A01, 0x6A07, 0x6A0B,
+	0x6A19, 0x6A23, 0x6A2F, 0x6A51, 0x6A5B, 0x6A67, 0x6A6B, 0x6A6D, 0x6A75, 0x6A83, 0x6A97, 0x6AB3,
+	0x6AB5, 0x6ABF, 0x6AC1, 0x6ACB, 0x6ACD, 0x6AE9, 0x6AEF, 0x6AFB, 0x6AFD, 0x6B03, 0x6B17, 0x6B2B,
+	0x6B33, 0x6B39, 0x6B47, 0x6B4B, 0x6B55, 0x6B69, 0x6B7D, 0x6B81, 0x6B8D, 0x6B95, 0x6B9F, 0x6BA3,
+	0x6BA5, 0x6BB1, 0x6BB7, 0x6BC5, 0x6BD7, 0x6BE1, 0x6BED, 0x6BF3, 0x6BF9, 0x6C0B, 0x6C19, 0x6C2F,
+	0x6C3D, 0x6C45, 0x6C57, 0x6C61, 0x6C73, 0x6CB5, 0x6CB9, 0x6CBF, 0x6CC1, 0x6CC7, 0x6CCB, 0x6CE5,
+	0x6CF1, 0x6D05, 0x6D09, 0x6D0F, 0x6D17, 0x6D2B, 0x6D53, 0x6D63, 0x6D65, 0x6D69, 0x6D7B, 0x6DA3,
+	0x6DB1, 0x6DBB, 0x6DBD, 0x6DC3, 0x6DC5, 0x6DDD, 0x6E09, 0x6E27, 0x6E2D, 0x6E33, 0x6E41, 0x6E4D,
+	0x6E53, 0x6E6F, 0x6E7B, 0x6E81, 0x6E87, 0x6E95, 0x6EAF, 0x6EB7, 0x6EC3, 0x6EDB, 0x6EDD, 0x6EF9,
+	0x6F01, 0x6F15, 0x6F29, 0x6F31, 0x6F3B, 0x6F4F, 0x6F57, 0x6F5B, 0x6F61, 0x6F85, 0x6F91, 0x6F97,
+	0x6FAB, 0x6FB5, 0x6FC7, 0x6FD9, 0x6FDF, 0x6FE9, 0x7005, 0x701D, 0x702B, 0x7033, 0x7035, 0x704B,
+	0x707D, 0x7081, 0x708D, 0x70A9, 0x70B7, 0x70BB, 0x70C9, 0x70CF, 0x70DD, 0x70E1, 0x7113, 0x7115,
+	0x7119, 0x7123, 0x7131, 0x7137, 0x713D, 0x715D, 0x716B, 0x7189, 0x7197, 0x719B, 0x71A1, 0x71B5,
+	0x71BF, 0x71CB, 0x71DF, 0x71E5, 0x71F7, 0x71FB, 0x7219, 0x721F, 0x722F, 0x7231, 0x723B, 0x724F,
+	0x7261, 0x7267, 0x728F, 0x72AD, 0x72B3, 0x72C1, 0x72CD, 0x72D3, 0x72DF, 0x72E5, 0x72F1, 0x72F7,
+	0x7303, 0x7309, 0x7327, 0x732B, 0x7341, 0x7355, 0x7365, 0x736F, 0x738D, 0x7393, 0x73A5, 0x73BD,
+	0x73C9, 0x73D1, 0x73E7, 0x73F3, 0x73F5, 0x73FF, 0x7413, 0x7415, 0x7429, 0x744F, 0x7457, 0x745B,
+	0x746B, 0x746D, 0x7483, 0x74AB, 0x74B3, 0x74C7, 0x74CD, 0x74D5, 0x74DF, 0x74E9, 0x74FB, 0x74FD,
+	0x7517, 0x751B, 0x7521, 0x7535, 0x7541, 0x754B, 0x7577, 0x757B, 0x7581, 0x7599, 0x75A3, 0x75BD,
+	0x75CF, 0x75D1, 0x75EB, 0x75F5, 0x75F9, 0x75FF, 0x761D, 0x7639, 0x7647, 0x7653, 0x7655, 0x765F,
+	0x7663, 0x7665, 0x7669, 0x7687, 0x7695, 0x769F, 0x76A3, 0x76AF, 0x76BB, 0x76C5, 0x76D1, 0x76EB,
+	0x76F3, 0x76F9, 0x770B, 0x772F, 0x7749, 0x7751, 0x7757, 0x776D, 0x7773, 0x7783, 0x7789, 0x77A7,
+	0x77AD, 0x77B5, 0x77C7, 0x77D3, 0x77D5, 0x77EF, 0x7815, 0x7825, 0x7831, 0x783D, 0x784F, 0x7851,
+	0x785B, 0x786D, 0x78A7, 0x78AD, 0x78B3, 0x78BF, 0x78CB, 0x78CD, 0x78D9, 0x78DF, 0x78E9, 0x78EF,
+	0x7903, 0x790F, 0x7917, 0x7927, 0x7933, 0x794D, 0x7959, 0x796F, 0x7971, 0x797B, 0x7981, 0x7987,
+	0x79A5, 0x79B1, 0x79C5, 0x79C9, 0x79D7, 0x79DD, 0x7A03, 0x7A1B, 0x7A27, 0x7A2B, 0x7A35, 0x7A3F,
+	0x7A4B, 0x7A55, 0x7A77, 0x7A81, 0x7A8D, 0x7AA9, 0x7AB7, 0x7ABB, 0x7AC3, 0x7AE1, 0x7AF3, 0x7AF5,
+	0x7B0B, 0x7B23, 0x7B3B, 0x7B45, 0x7B4F, 0x7B51, 0x7B5D, 0x7B67, 0x7B79, 0x7B85, 0x7B8F, 0x7BA1,
+	0x7BAB, 0x7BB9, 0x7BD3, 0x7BE3, 0x7BF1, 0x7BF7, 0x7C05, 0x7C09, 0x7C27, 0x7C2D, 0x7C59, 0x7C69,
+	0x7C7D, 0x7C8B, 0x7C93, 0x7C95, 0x7CA3, 0x7CB7, 0x7CC3, 0x7CD1, 0x7CDD, 0x7CEB, 0x7CF9, 0x7CFF,
+	0x7D01, 0x7D15, 0x7D37, 0x7D45, 0x7D49, 0x7D73, 0x7D79, 0x7D8F, 0x7D91, 0x7D97, 0x7DA7, 0x7DB3,
+	0x7DC7, 0x7DCD, 0x7DD5, 0x7DE9, 0x7DFB, 0x7DFD, 0x7E01, 0x7E0D, 0x7E19, 0x7E2F, 0x7E45, 0x7E61,
+	0x7E75, 0x7E7F, 0x7E89, 0x7E8F, 0x7E9B, 0x7E9D, 0x7EAB, 0x7EBF, 0x7EC7, 0x7ED3, 0x7EE3, 0x7EE5,
+	0x7F09, 0x7F21, 0x7F3F, 0x7F4D, 0x7F55, 0x7F71, 0x7F8B, 0x7F8D, 0x7F99, 0x7F9F, 0x7FA3, 0x7FB1,
+	0x7FC3, 0x7FC5, 0x7FD1, 0x7FD7, 0x7FE1, 0x7FE7
+};
+
+#else
+
+unsigned int const tms::gf2poly::precomputed::max_degree = 0;
+
+std::size_t  const tms::gf2poly::precomputed::count      = 0;
+
+uint32_t     const tms::gf2poly::precomputed::masks[]    = {0};
+
+#endif // #ifndef TMS_NO_IRRPOLY_TABLE
@@ -0,0 +1,213 @@
+#include "../../include/tms-nets/details/netfile.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+
+namespace
+{
+
+	char const     sc_magic[8]      = {'T', 'M', 'S', 'N', 'E', 'T', 'S', '\0'};
+	uint32_t const sc_byte_order    = 0x01020304;
+
+	static_assert(sizeof(tms::netfile::Header) == 64, "Header must have no padding");
+	static_assert(sizeof(tms::GenNumInt) == sizeof(uint64_t), "Generating numbers are stored as 64-bit words");
+
+
+	/// Rounds the value up to a multiple of the alignment
+	uint64_t align_up(uint64_t value, uint64_t alignment)
+	{
+		return (value + alignment - 1)/alignment*alignment;
+	}
+
+	/** Maps the whole file into memory for reading, the file is unmapped when the last copy of the pointer is destroyed
+	 *  @param [in] path - path of the file
+	 *  @param [out] size - size of the file in bytes */
+	std::shared_ptr<unsigned char const> map_file(std::string const &path, std::size_t &size)
+	{
+#ifdef _WIN32
+		HANDLE const file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if ( file == INVALID_HANDLE_VALUE )
+		{
+			throw std::runtime_error("\nCan't open file " + path + "\n");
+		}
+		LARGE_INTEGER file_size;
+		if ( !GetFileSizeEx(file, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(tms::netfile::Header)) )
+		{
+			CloseHandle(file);
+			throw std::logic_error("\nFile " + path + " is too small to contain a net\n");
+		}
+		size = static_cast<std::size_t>(file_size.QuadPart);
+		HANDLE const mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		CloseHandle(file);
+		if ( mapping == nullptr )
+		{
+			throw std::runtime_error("\nCan't map file " + path + "\n");
+		}
+		// the view keeps the mapping object alive after its handle is closed
+		void const *data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mapping);
+		if ( data == nullptr )
+		{
+			throw std::runtime_error("\nCan't map file " + path + "\n");
+		}
+		return std::shared_ptr<unsigned char const>(static_cast<unsigned char const *>(data),
+													[](unsigned char const *view) { UnmapViewOfFile(view); });
+#else
+		int const file = open(path.c_str(), O_RDONLY);
+		if ( file < 0 )
+		{
+			throw std::runtime_error("\nCan't open file " + path + "\n");
+		}
+		struct stat file_stat;
+		if ( fstat(file, &file_stat) != 0 || file_stat.st_size < static_cast<off_t>(sizeof(tms::netfile::Header)) )
+		{
+			close(file);
+			throw std::logic_error("\nFile " + path + " is too small to contain a net\n");
+		}
+		size = static_cast<std::size_t>(file_stat.st_size);
+		// the mapping stays valid after the descriptor is closed
+		void *data = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+		close(file);
+		if ( data == MAP_FAILED )
+		{
+			throw std::runtime_error("\nCan't map file " + path + "\n");
+		}
+		return std::shared_ptr<unsigned char const>(static_cast<unsigned char const *>(data),
+													[size](unsigned char const *view) { munmap(const_cast<unsigned char *>(view), size); });
+#endif
+	}
+
+}
+
+
+void
+tms::netfile::save(std::string             const &path,
+				   NetKind                        kind,
+				   BasicInt                       nbits,
+				   BasicInt                       dim,
+				   GenNumInt               const *table,
+				   std::vector<Polynomial> const &irrpolys)
+{
+	Header header;
+	std::memcpy(header.magic, sc_magic, sizeof(sc_magic));
+	header.version      = format_version;
+	header.byte_order   = sc_byte_order;
+	header.kind         = static_cast<uint32_t>(kind);
+	header.nbits        = nbits;
+	header.dim          = dim;
+	header.word_size    = sizeof(GenNumInt);
+	header.table_offset = align_up(sizeof(Header), table_alignment);
+	header.polys_offset = header.table_offset + static_cast<uint64_t>(nbits)*dim*sizeof(GenNumInt);
+	header.polys_count  = irrpolys.size();
+	header.file_size    = header.polys_offset;
+	for (Polynomial const &poly : irrpolys)
+	{
+		header.file_size += (poly.words().size() + 1)*sizeof(uint64_t);
+	}
+
+	std::ofstream file(path, std::ios::binary | std::ios::trunc);
+	if ( !file )
+	{
+		throw std::runtime_error("\nCan't open file " + path + " for writing\n");
+	}
+
+	std::vector<char> const padding(header.table_offset - sizeof(Header), 0);
+	file.write(reinterpret_cast<char const *>(&header), sizeof(Header));
+	file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+	file.write(reinterpret_cast<char const *>(table), static_cast<std::streamsize>(header.polys_offset - header.table_offset));
+	for (Polynomial const &poly : irrpolys)
+	{
+		uint64_t const words_count = poly.words().size();
+		file.write(reinterpret_cast<char const *>(&words_count), sizeof(words_count));
+		file.write(reinterpret_cast<char const *>(poly.words().data()), static_cast<std::streamsize>(words_count*sizeof(uint64_t)));
+	}
+
+	if ( !file.flush() )
+	{
+		throw std::runtime_error("\nCan't write file " + path + "\n");
+	}
+}
+
+tms::netfile::Contents
+tms::netfile::load(std::string const &path,
+				   NetKind            kind)
+{
+	std::size_t                                size = 0;
+	std::shared_ptr<unsigned char const> const data = map_file(path, size);
+
+	Contents contents;
+	Header  &header = contents.header;
+	std::memcpy(&header, data.get(), sizeof(Header));
+
+	if ( std::memcmp(header.magic, sc_magic, sizeof(sc_magic)) != 0 )
+	{
+		throw std::logic_error("\nFile " + path + " doesn't contain a net\n");
+	}
+	if ( header.byte_order != sc_byte_order || header.word_size != sizeof(GenNumInt) )
+	{
+		throw std::logic_error("\nFile " + path + " was written on a machine with another representation of numbers\n");
+	}
+	if ( header.version != format_version )
+	{
+		throw std::logic_error("\nFile " + path + " has version " + std::to_string(header.version) + \
+							   " of the format, expected " + std::to_string(format_version) + "\n");
+	}
+	if ( kind != NetKind::digital_net && header.kind != static_cast<uint32_t>(kind) )
+	{
+		throw std::logic_error("\nFile " + path + " contains a net of another kind\n");
+	}
+
+	if ( header.nbits > max_nbits || header.file_size != size || header.table_offset % table_alignment != 0 || \
+		 header.table_offset < sizeof(Header) || header.table_offset > size )
+	{
+		throw std::logic_error("\nFile " + path + " is corrupted\n");
+	}
+	// offsets are compared with what is left of the file, so that huge values can't wrap around
+	uint64_t const table_size = static_cast<uint64_t>(header.nbits)*header.dim*sizeof(GenNumInt);
+	if ( table_size > size - header.table_offset || header.polys_offset != header.table_offset + table_size || \
+		 header.polys_count > (size - header.polys_offset)/sizeof(uint64_t) )
+	{
+		throw std::logic_error("\nFile " + path + " is corrupted\n");
+	}
+
+	// the table is used in place, the pointer shares the ownership of the mapping
+	contents.table = std::shared_ptr<GenNumInt const>(data, reinterpret_cast<GenNumInt const *>(data.get() + header.table_offset));
+
+	// every polynomial takes at least one word, so the amount of them is bounded by the size of the file above
+	uint64_t offset = header.polys_offset;
+	contents.irrpolys.reserve(header.polys_count);
+	for (uint64_t poly_i = 0; poly_i < header.polys_count; ++poly_i)
+	{
+		uint64_t words_count = 0;
+		if ( size - offset < sizeof(uint64_t) )
+		{
+			throw std::logic_error("\nFile " + path + " is corrupted\n");
+		}
+		std::memcpy(&words_count, data.get() + offset, sizeof(uint64_t));
+		offset += sizeof(uint64_t);
+		if ( (size - offset)/sizeof(uint64_t) < words_count )
+		{
+			throw std::logic_error("\nFile " + path + " is corrupted\n");
+		}
+		std::vector<uint64_t> words(words_count);
+		std::memcpy(words.data(), data.get() + offset, words_count*sizeof(uint64_t));
+		offset += words_count*sizeof(uint64_t);
+		contents.irrpolys.push_back(Polynomial::from_words(std::move(words)));
+	}
+
+	return contents;
+}
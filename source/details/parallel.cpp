@@ -0,0 +1,271 @@
+#include "../../include/tms-nets/details/parallel.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+
+
+
+
+namespace
+{
+	
+	/// Tasks submitted by one call of ThreadPool::run
+	struct Batch
+	{
+		std::atomic<std::size_t> remaining;
+		std::exception_ptr       first_exception;
+		std::mutex               mutex;
+		std::condition_variable  finished;
+	};
+	
+	struct Item
+	{
+		tms::parallel::ThreadPool::Task  task;
+		Batch                           *batch;
+	};
+	
+	struct Queue
+	{
+		std::mutex       mutex;
+		std::deque<Item> items;
+	};
+	
+	/// Index of the queue owned by the current thread (threads outside of pools use the queue 0)
+	thread_local std::size_t tl_home_queue = 0;
+	
+}
+
+
+
+
+
+struct tms::parallel::ThreadPool::State
+{
+	std::vector<std::unique_ptr<Queue>> queues;
+	std::vector<std::thread>            workers;
+	
+	std::atomic<std::size_t>            queued;
+	std::atomic<std::size_t>            next_queue;
+	
+	std::mutex                          sleep_mutex;
+	std::condition_variable             wake;
+	bool                                stop;
+	
+	State(void) :
+		queued(0),
+		next_queue(0),
+		stop(false)
+	{}
+	
+	/// Takes a task from the home queue or steals one from the others and executes it, returns false if there were none
+	bool try_run_one(std::size_t home)
+	{
+		std::size_t const count = queues.size();
+		for (std::size_t shift = 0; shift < count; ++shift)
+		{
+			Queue &queue = *queues[(home + shift) % count];
+			Item   item;
+			{
+				std::lock_guard<std::mutex> lock(queue.mutex);
+				if ( queue.items.empty() )
+				{
+					continue;
+				}
+				if ( shift == 0 )
+				{
+					item = std::move(queue.items.back());
+					queue.items.pop_back();
+				}
+				else
+				{
+					item = std::move(queue.items.front());
+					queue.items.pop_front();
+				}
+			}
+			--queued;
+			execute(item);
+			return true;
+		}
+		return false;
+	}
+	
+	static void execute(Item &item)
+	{
+		try
+		{
+			item.task();
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> lock(item.batch->mutex);
+			if ( !item.batch->first_exception )
+			{
+				item.batch->first_exception = std::current_exception();
+			}
+		}
+		// the batch lives on the stack of the submitting thread, so it is released under the lock
+		std::lock_guard<std::mutex> lock(item.batch->mutex);
+		if ( --item.batch->remaining == 0 )
+		{
+			item.batch->finished.notify_all();
+		}
+	}
+	
+	void work(std::size_t home)
+	{
+		tl_home_queue = home;
+		while ( true )
+		{
+			if ( try_run_one(home) )
+			{
+				continue;
+			}
+			std::unique_lock<std::mutex> lock(sleep_mutex);
+			wake.wait(lock, [this](void) { return stop || queued.load() != 0; });
+			if ( stop && queued.load() == 0 )
+			{
+				return;
+			}
+		}
+	}
+};
+
+
+
+
+
+tms::parallel::ThreadPool::ThreadPool(unsigned int threads) :
+	m_state(new State)
+{
+	threads = concurrency(threads);
+	// queue 0 is shared by all threads outside of the pool, the others belong to the workers
+	for (unsigned int i = 0; i < threads; ++i)
+	{
+		m_state->queues.emplace_back(new Queue);
+	}
+	for (unsigned int i = 1; i < threads; ++i)
+	{
+		m_state->workers.emplace_back(&State::work, m_state.get(), i);
+	}
+}
+
+tms::parallel::ThreadPool::~ThreadPool(void)
+{
+	{
+		std::lock_guard<std::mutex> lock(m_state->sleep_mutex);
+		m_state->stop = true;
+	}
+	m_state->wake.notify_all();
+	for (std::thread &worker : m_state->workers)
+	{
+		worker.join();
+	}
+}
+
+unsigned int
+tms::parallel::ThreadPool::size(void) const
+{
+	return static_cast<unsigned int>(m_state->queues.size());
+}
+
+void
+tms::parallel::ThreadPool::run(std::vector<Task> tasks)
+{
+	if ( tasks.empty() )
+	{
+		return;
+	}
+	
+	Batch batch;
+	batch.remaining = tasks.size();
+	
+	// tasks are counted before they become visible, otherwise a worker stealing one first would decrement
+	// the counter below zero and wrap it, so idle workers would spin instead of sleeping
+	{
+		std::lock_guard<std::mutex> lock(m_state->sleep_mutex);
+		m_state->queued += tasks.size();
+	}
+	
+	// the whole batch is spread over the queues taking each lock once
+	std::size_t const count = m_state->queues.size();
+	std::size_t const first = m_state->next_queue++;
+	for (std::size_t shift = 0; shift < count && shift < tasks.size(); ++shift)
+	{
+		Queue &queue = *m_state->queues[(first + shift) % count];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		for (std::size_t task_i = shift; task_i < tasks.size(); task_i += count)
+		{
+			queue.items.push_back({std::move(tasks[task_i]), &batch});
+		}
+	}
+	m_state->wake.notify_all();
+	
+	// the submitting thread helps until there is nothing to take, then waits for the tasks taken by others
+	std::size_t const home = tl_home_queue < count ? tl_home_queue : 0;
+	while ( batch.remaining.load() != 0 && m_state->try_run_one(home) )
+	{}
+	{
+		std::unique_lock<std::mutex> lock(batch.mutex);
+		batch.finished.wait(lock, [&batch](void) { return batch.remaining.load() == 0; });
+	}
+	
+	if ( batch.first_exception )
+	{
+		std::rethrow_exception(batch.first_exception);
+	}
+}
+
+tms::parallel::ThreadPool&
+tms::parallel::ThreadPool::global(void)
+{
+	static ThreadPool sc_pool;
+	return sc_pool;
+}
+
+
+
+
+
+unsigned int
+tms::parallel::concurrency(unsigned int threads)
+{
+	if ( threads == 0 )
+	{
+		threads = std::thread::hardware_concurrency();
+	}
+	return std::max(threads, 1U);
+}
+
+void
+tms::parallel::for_each_index(std::size_t                              count,
+							  std::function<void (std::size_t)> const &task,
+							  unsigned int                             threads)
+{
+	ThreadPool        &pool  = ThreadPool::global();
+	std::size_t const  lanes = std::min<std::size_t>(threads == 0 ? pool.size() : std::min(threads, pool.size()), count);
+	
+	if ( lanes <= 1 )
+	{
+		for (std::size_t index = 0; index < count; ++index)
+		{
+			task(index);
+		}
+		return;
+	}
+	
+	// each lane is one task of the pool taking indices one by one
+	std::atomic<std::size_t>       next_index(0);
+	std::vector<ThreadPool::Task>  lane_tasks(lanes, [&](void) {
+		for (std::size_t index = next_index++; index < count; index = next_index++)
+		{
+			task(index);
+		}
+	});
+	pool.run(std::move(lane_tasks));
+}
@@ -1,5 +1,8 @@
 #include "../../include/tms-nets/details/recseq.hpp"
 #include "../../include/tms-nets/details/gf2poly.hpp"
+#include "../../include/tms-nets/details/bitops.hpp"
+
+#include <algorithm>
 
 
 
@@ -36,34 +39,89 @@ std::vector<tms::BasicInt> tms::recseq::unpack_initial_values(uintmax_t packed_i
 
 void tms::recseq::fill_vector_recursively(std::vector<BasicInt> &container, uintmax_t init_values, Polynomial const &char_poly)
 {
-	if ( char_poly.size() != 1 )
+	std::vector<uint64_t> words;
+	fill_words_recursively(words, container.size(), init_values, char_poly);
+	
+	for (CountInt seq_i = 0; seq_i < container.size(); ++seq_i)
+	{
+		container[seq_i] = (words[seq_i/64] >> (seq_i % 64)) & 1;
+	}
+}
+
+void tms::recseq::fill_words_recursively(std::vector<uint64_t> &words, CountInt count, uintmax_t init_values, Polynomial const &char_poly)
+{
+	if ( char_poly.size() < 2 )
+	{
+		throw std::logic_error("Constant polynomial can't be a characteristic polynomial\n");
+	}
+	
+	CountInt const deg = static_cast<CountInt>(char_poly.degree());
+	
+	words.assign((count + 63)/64, 0);
+	if ( count == 0 )
 	{
-		CountInt seq_i = 0;
-		
-		CountInt const deg = static_cast<CountInt>(char_poly.degree());
-		
-		while ( seq_i < deg && seq_i < container.size() )
+		return;
+	}
+	
+	CountInt const init_count = std::min<CountInt>({deg, count, 64});
+	words[0] = init_values & (init_count == 64 ? ~0ULL : (1ULL << init_count) - 1);
+	
+	// the n-th term is the parity of the coefficients mask and of the previous deg terms
+	CountInt const serial_count = std::min<CountInt>(count, 64*deg);
+	if ( deg <= 64 )
+	{
+		uint64_t const mask  = char_poly.words()[0] & (deg == 64 ? ~0ULL : (1ULL << deg) - 1);
+		uint64_t       state = words[0];
+		for (CountInt seq_i = deg; seq_i < serial_count; ++seq_i)
 		{
-			container[seq_i] = init_values & 1;
-			init_values >>= 1;
-			++seq_i;
+			uint64_t const term = bitops::parity(state & mask);
+			words[seq_i/64] |= term << (seq_i % 64);
+			state = (state >> 1) | (term << (deg - 1));
 		}
-		//i == deg
-		
-		while ( seq_i < container.size() )
+	}
+	else
+	{
+		std::vector<uint64_t> mask = char_poly.words();
+		mask[deg/64] &= (1ULL << (deg % 64)) - 1;
+		for (CountInt seq_i = deg; seq_i < serial_count; ++seq_i)
 		{
-			container[seq_i] = 0;
-			for (BasicInt poly_i = 0; poly_i < deg; ++poly_i)
+			uint64_t acc = 0;
+			for (CountInt word_i = 0; word_i < mask.size(); ++word_i)
 			{
-				container[seq_i] ^= char_poly[poly_i] & container[seq_i - deg + poly_i];
+				acc ^= mask[word_i] & extract_terms(words, seq_i - deg + 64*word_i, 64);
 			}
-			++seq_i;
+			words[seq_i/64] |= static_cast<uint64_t>(bitops::parity(acc)) << (seq_i % 64);
 		}
 	}
-	else
+	
+	// c(x)^64 = c(x^64) is also a characteristic polynomial, so 64 consecutive terms satisfy the same recurrence
+	// with the terms that are 64 positions apart, i.e. the words of the sequence satisfy it
+	for (CountInt word_i = deg; word_i < words.size(); ++word_i)
 	{
-		throw std::logic_error("Constant polynomial can't be a characteristic polynomial\n");
+		for (CountInt poly_i = 0; poly_i < deg; ++poly_i)
+		{
+			words[word_i] ^= words[word_i - deg + poly_i] & (0 - static_cast<uint64_t>(char_poly[poly_i]));
+		}
 	}
+	
+	if ( count % 64 != 0 )
+	{
+		words.back() &= (1ULL << (count % 64)) - 1;
+	}
+}
+
+uint64_t tms::recseq::extract_terms(std::vector<uint64_t> const &words, CountInt pos, BasicInt count)
+{
+	CountInt const     word_i = pos/64;
+	unsigned int const shift  = static_cast<unsigned int>(pos % 64);
+	
+	uint64_t terms = word_i < words.size() ? words[word_i] >> shift : 0;
+	if ( shift != 0 && word_i + 1 < words.size() )
+	{
+		terms |= words[word_i + 1] << (64 - shift);
+	}
+	
+	return count < 64 ? terms & ((1ULL << count) - 1) : terms;
 }
 
 uintmax_t tms::recseq::initial_poly_to_initial_values(Polynomial const &init_poly, Polynomial const &char_poly)
@@ -0,0 +1,335 @@
+#include "../../include/tms-nets/details/simd.hpp"
+
+#include <algorithm>
+
+#if ( defined(__x86_64__) || defined(__i386__) ) && ( defined(__GNUC__) || defined(__clang__) )
+#define TMS_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+
+
+
+
+namespace
+{
+	
+	using XorRowsKernel       = void (*)(tms::GenNumInt *, tms::GenNumInt const *, tms::GenNumInt const *, std::size_t);
+	using IntToDoubleKernel   = void (*)(double *, tms::GenNumInt const *, std::size_t, double);
+	using ClmulKernel         = void (*)(uint64_t *, uint64_t const *, std::size_t, uint64_t const *, std::size_t);
+	using MultiplyByMinKernel = void (*)(double *, double const *, double, std::size_t);
+	
+	struct Kernels
+	{
+		XorRowsKernel        xor_rows;
+		IntToDoubleKernel    int_to_double;
+		char const          *name;
+		ClmulKernel          clmul;
+		MultiplyByMinKernel  multiply_by_min;
+	};
+	
+	
+	
+	void xor_rows_scalar(tms::GenNumInt *dst, tms::GenNumInt const *src, tms::GenNumInt const *row, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			dst[i] = src[i] ^ row[i];
+		}
+	}
+	
+	void int_to_double_scalar(double *out, tms::GenNumInt const *src, std::size_t count, double scale)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			out[i] = static_cast<double>(src[i])*scale;
+		}
+	}
+	
+	void multiply_by_min_scalar(double *products, double const *row, double value, std::size_t count)
+	{
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			products[i] *= row[i] < value ? row[i] : value;
+		}
+	}
+	
+	/// Carry-less product of two words, processed by 4-bit windows
+	void clmul_word_scalar(uint64_t a, uint64_t b, uint64_t &lo, uint64_t &hi)
+	{
+		// products of a by all polynomials of degree less than 4, hi parts keep the bits shifted out of lo parts
+		uint64_t table_lo[16];
+		uint64_t table_hi[16];
+		table_lo[0] = table_hi[0] = 0;
+		table_lo[1] = a;
+		table_hi[1] = 0;
+		for (unsigned int k = 2; k < 16; k += 2)
+		{
+			table_lo[k]     = table_lo[k/2] << 1;
+			table_hi[k]     = (table_hi[k/2] << 1) | (table_lo[k/2] >> 63);
+			table_lo[k + 1] = table_lo[k] ^ a;
+			table_hi[k + 1] = table_hi[k];
+		}
+		
+		lo = hi = 0;
+		for (int shift = 60; shift >= 0; shift -= 4)
+		{
+			hi = (hi << 4) | (lo >> 60);
+			lo <<= 4;
+			unsigned int const nibble = (b >> shift) & 15;
+			lo ^= table_lo[nibble];
+			hi ^= table_hi[nibble];
+		}
+	}
+	
+	void clmul_scalar(uint64_t *out, uint64_t const *a, std::size_t a_count, uint64_t const *b, std::size_t b_count)
+	{
+		std::fill(out, out + a_count + b_count, 0);
+		for (std::size_t i = 0; i < a_count; ++i)
+		{
+			for (std::size_t j = 0; j < b_count; ++j)
+			{
+				uint64_t lo, hi;
+				clmul_word_scalar(a[i], b[j], lo, hi);
+				out[i + j]     ^= lo;
+				out[i + j + 1] ^= hi;
+			}
+		}
+	}
+	
+	
+	
+#ifdef TMS_SIMD_X86
+	
+	static_assert(sizeof(tms::GenNumInt) == 8, "Vectorized kernels expect 64-bit generating numbers");
+	
+	// Unsigned 64-bit integers are converted to double with two exact steps and a single rounding:
+	// the high and the low halves are inserted into mantissas of 2^84 and 2^52 respectively, then
+	// (hi - (2^84 + 2^52)) + lo gives the correctly rounded value, the same as static_cast<double>.
+	uint64_t const sc_exp84    = 0x4530000000000000ULL;
+	uint64_t const sc_exp52    = 0x4330000000000000ULL;
+	uint64_t const sc_low_mask = 0x00000000FFFFFFFFULL;
+	double   const sc_exp84_52 = 19342813118337666422669312.0; // 2^84 + 2^52
+	
+	__attribute__((target("sse2")))
+	void xor_rows_sse2(tms::GenNumInt *dst, tms::GenNumInt const *src, tms::GenNumInt const *row, std::size_t count)
+	{
+		std::size_t i = 0;
+		for ( ; i + 2 <= count; i += 2)
+		{
+			__m128i a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+			__m128i b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(row + i));
+			_mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i), _mm_xor_si128(a, b));
+		}
+		xor_rows_scalar(dst + i, src + i, row + i, count - i);
+	}
+	
+	__attribute__((target("sse2")))
+	void int_to_double_sse2(double *out, tms::GenNumInt const *src, std::size_t count, double scale)
+	{
+		__m128i const exp84    = _mm_set1_epi64x(static_cast<long long>(sc_exp84));
+		__m128i const exp52    = _mm_set1_epi64x(static_cast<long long>(sc_exp52));
+		__m128i const low_mask = _mm_set1_epi64x(static_cast<long long>(sc_low_mask));
+		__m128d const exp84_52 = _mm_set1_pd(sc_exp84_52);
+		__m128d const factor   = _mm_set1_pd(scale);
+		std::size_t i = 0;
+		for ( ; i + 2 <= count; i += 2)
+		{
+			__m128i x  = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+			__m128d hi = _mm_castsi128_pd(_mm_or_si128(_mm_srli_epi64(x, 32), exp84));
+			__m128d lo = _mm_castsi128_pd(_mm_or_si128(_mm_and_si128(x, low_mask), exp52));
+			__m128d r  = _mm_add_pd(_mm_sub_pd(hi, exp84_52), lo);
+			_mm_storeu_pd(out + i, _mm_mul_pd(r, factor));
+		}
+		int_to_double_scalar(out + i, src + i, count - i, scale);
+	}
+	
+	// min(a, b) instructions return b unless a < b, exactly like the scalar kernel, so results are identical
+	__attribute__((target("sse2")))
+	void multiply_by_min_sse2(double *products, double const *row, double value, std::size_t count)
+	{
+		__m128d const bound = _mm_set1_pd(value);
+		std::size_t i = 0;
+		for ( ; i + 2 <= count; i += 2)
+		{
+			__m128d factor = _mm_min_pd(_mm_loadu_pd(row + i), bound);
+			_mm_storeu_pd(products + i, _mm_mul_pd(_mm_loadu_pd(products + i), factor));
+		}
+		multiply_by_min_scalar(products + i, row + i, value, count - i);
+	}
+	
+	__attribute__((target("avx2")))
+	void xor_rows_avx2(tms::GenNumInt *dst, tms::GenNumInt const *src, tms::GenNumInt const *row, std::size_t count)
+	{
+		std::size_t i = 0;
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m256i a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+			__m256i b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(row + i));
+			_mm256_storeu_si256(reinterpret_cast<__m256i *>(dst + i), _mm256_xor_si256(a, b));
+		}
+		xor_rows_scalar(dst + i, src + i, row + i, count - i);
+	}
+	
+	__attribute__((target("avx2")))
+	void int_to_double_avx2(double *out, tms::GenNumInt const *src, std::size_t count, double scale)
+	{
+		__m256i const exp84    = _mm256_set1_epi64x(static_cast<long long>(sc_exp84));
+		__m256i const exp52    = _mm256_set1_epi64x(static_cast<long long>(sc_exp52));
+		__m256i const low_mask = _mm256_set1_epi64x(static_cast<long long>(sc_low_mask));
+		__m256d const exp84_52 = _mm256_set1_pd(sc_exp84_52);
+		__m256d const factor   = _mm256_set1_pd(scale);
+		std::size_t i = 0;
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m256i x  = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+			__m256d hi = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(x, 32), exp84));
+			__m256d lo = _mm256_castsi256_pd(_mm256_or_si256(_mm256_and_si256(x, low_mask), exp52));
+			__m256d r  = _mm256_add_pd(_mm256_sub_pd(hi, exp84_52), lo);
+			_mm256_storeu_pd(out + i, _mm256_mul_pd(r, factor));
+		}
+		int_to_double_scalar(out + i, src + i, count - i, scale);
+	}
+	
+	__attribute__((target("avx2")))
+	void multiply_by_min_avx2(double *products, double const *row, double value, std::size_t count)
+	{
+		__m256d const bound = _mm256_set1_pd(value);
+		std::size_t i = 0;
+		for ( ; i + 4 <= count; i += 4)
+		{
+			__m256d factor = _mm256_min_pd(_mm256_loadu_pd(row + i), bound);
+			_mm256_storeu_pd(products + i, _mm256_mul_pd(_mm256_loadu_pd(products + i), factor));
+		}
+		multiply_by_min_scalar(products + i, row + i, value, count - i);
+	}
+	
+	__attribute__((target("avx512f")))
+	void xor_rows_avx512(tms::GenNumInt *dst, tms::GenNumInt const *src, tms::GenNumInt const *row, std::size_t count)
+	{
+		std::size_t i = 0;
+		for ( ; i + 8 <= count; i += 8)
+		{
+			__m512i a = _mm512_loadu_si512(src + i);
+			__m512i b = _mm512_loadu_si512(row + i);
+			_mm512_storeu_si512(dst + i, _mm512_xor_si512(a, b));
+		}
+		xor_rows_scalar(dst + i, src + i, row + i, count - i);
+	}
+	
+	__attribute__((target("avx512f,avx512dq")))
+	void int_to_double_avx512(double *out, tms::GenNumInt const *src, std::size_t count, double scale)
+	{
+		__m512d const factor = _mm512_set1_pd(scale);
+		std::size_t i = 0;
+		for ( ; i + 8 <= count; i += 8)
+		{
+			__m512i x = _mm512_loadu_si512(src + i);
+			_mm512_storeu_pd(out + i, _mm512_mul_pd(_mm512_cvtepu64_pd(x), factor));
+		}
+		int_to_double_scalar(out + i, src + i, count - i, scale);
+	}
+	
+	__attribute__((target("avx512f")))
+	void multiply_by_min_avx512(double *products, double const *row, double value, std::size_t count)
+	{
+		__m512d const bound = _mm512_set1_pd(value);
+		std::size_t i = 0;
+		for ( ; i + 8 <= count; i += 8)
+		{
+			// _mm512_min_pd passes an undefined vector through in GCC, the zero-masking form with all lanes
+			// selected computes the same minimum from explicitly initialised vectors
+			__m512d factor = _mm512_maskz_min_pd(0xFF, _mm512_loadu_pd(row + i), bound);
+			_mm512_storeu_pd(products + i, _mm512_mul_pd(_mm512_loadu_pd(products + i), factor));
+		}
+		multiply_by_min_scalar(products + i, row + i, value, count - i);
+	}
+	
+	__attribute__((target("sse2,pclmul")))
+	void clmul_pclmul(uint64_t *out, uint64_t const *a, std::size_t a_count, uint64_t const *b, std::size_t b_count)
+	{
+		std::fill(out, out + a_count + b_count, 0);
+		for (std::size_t i = 0; i < a_count; ++i)
+		{
+			__m128i const a_word = _mm_set_epi64x(0, static_cast<long long>(a[i]));
+			for (std::size_t j = 0; j < b_count; ++j)
+			{
+				__m128i const b_word = _mm_set_epi64x(0, static_cast<long long>(b[j]));
+				uint64_t product[2];
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(product), _mm_clmulepi64_si128(a_word, b_word, 0));
+				out[i + j]     ^= product[0];
+				out[i + j + 1] ^= product[1];
+			}
+		}
+	}
+	
+#endif // #ifdef TMS_SIMD_X86
+	
+	
+	
+	Kernels select_kernels(void)
+	{
+		Kernels selected = {xor_rows_scalar, int_to_double_scalar, "scalar", clmul_scalar, multiply_by_min_scalar};
+#ifdef TMS_SIMD_X86
+		__builtin_cpu_init();
+		if ( __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq") )
+		{
+			selected = {xor_rows_avx512, int_to_double_avx512, "avx512", clmul_scalar, multiply_by_min_avx512};
+		}
+		else if ( __builtin_cpu_supports("avx2") )
+		{
+			selected = {xor_rows_avx2, int_to_double_avx2, "avx2", clmul_scalar, multiply_by_min_avx2};
+		}
+		else if ( __builtin_cpu_supports("sse2") )
+		{
+			selected = {xor_rows_sse2, int_to_double_sse2, "sse2", clmul_scalar, multiply_by_min_sse2};
+		}
+		if ( __builtin_cpu_supports("sse2") && __builtin_cpu_supports("pclmul") )
+		{
+			selected.clmul = clmul_pclmul;
+		}
+#endif
+		return selected;
+	}
+	
+	Kernels const &kernels(void)
+	{
+		static Kernels const sc_kernels = select_kernels();
+		return sc_kernels;
+	}
+	
+}
+
+
+
+
+
+void
+tms::simd::xor_rows(GenNumInt *dst, GenNumInt const *src, GenNumInt const *row, std::size_t count)
+{
+	kernels().xor_rows(dst, src, row, count);
+}
+
+void
+tms::simd::int_to_double(double *out, GenNumInt const *src, std::size_t count, double scale)
+{
+	kernels().int_to_double(out, src, count, scale);
+}
+
+void
+tms::simd::clmul(uint64_t *out, uint64_t const *a, std::size_t a_count, uint64_t const *b, std::size_t b_count)
+{
+	kernels().clmul(out, a, a_count, b, b_count);
+}
+
+void
+tms::simd::multiply_by_min(double *products, double const *row, double value, std::size_t count)
+{
+	kernels().multiply_by_min(products, row, value, count);
+}
+
+char const *
+tms::simd::instruction_set(void)
+{
+	return kernels().name;
+}
@@ -1,4 +1,7 @@
 #include "../include/tms-nets/digital_net.hpp"
+#include "../include/tms-nets/details/genmat.hpp"
+#include "../include/tms-nets/details/random.hpp"
+#include "../include/tms-nets/details/simd.hpp"
 
 
 namespace tms
@@ -8,7 +11,8 @@ namespace tms
 	    m_nbits(0),
 	    m_dim(0),
 	    m_recip(1),
-	    m_generating_numbers()
+	    m_generating_numbers(),
+	    m_transposed_numbers()
 	{}
 	
 	DigitalNet::DigitalNet(std::vector<GenNum> const &generating_numbers) :
@@ -24,6 +28,7 @@ namespace tms
 		{
 			throw std::logic_error("\nDirection numbers have different sizes\n");
 		}
+		update_transposed_numbers();
 	}
 	
 	DigitalNet::DigitalNet(std::vector<GenMat> const &generating_matrices) :
@@ -46,12 +51,29 @@ namespace tms
 		{
 			throw std::logic_error("\nGenerating matrices have different sizes\n");
 		}
+		update_transposed_numbers();
 	}
 	
+	DigitalNet::DigitalNet(std::string const &path) :
+	    DigitalNet(netfile::load(path, netfile::NetKind::digital_net))
+	{}
+	
 	DigitalNet::~DigitalNet(void)
 	{}
 	
 	
+	GenNum
+	DigitalNet::generating_numbers(BasicInt dim) const
+	{
+		GenNum numbers(m_nbits);
+		for (BasicInt k = 0; k < m_nbits; ++k)
+		{
+			numbers[k] = m_transposed_numbers.get()[k*m_dim + dim];
+		}
+		return numbers;
+	}
+	
+	
 	Point
 	DigitalNet::generate_point_classical(CountInt pos) const
 	{
@@ -61,7 +83,11 @@ namespace tms
 			uintmax_t acc = 0;
 			for (int k = 0; k < m_nbits; ++k)
 			{
-				acc ^= m_generating_numbers[i][k] * ((pos >> k) & 1);
+				acc ^= m_transposed_numbers.get()[k*m_dim + i] * ((pos >> k) & 1);
+			}
+			if ( !m_shift.empty() )
+			{
+				acc ^= m_shift[i];
 			}
 			point[i] = static_cast<Real>(acc) * m_recip;
 		}
@@ -92,35 +118,164 @@ namespace tms
 							   CountInt amount,
 							   CountInt pos) const
 	{
-		if ( amount != 0 )
+		for_each_point<Real, std::function<void (Point const &, CountInt)> &>(handler, amount, pos);
+	}
+	
+	void
+	DigitalNet::for_each_int_point(std::function<void (IntPoint const &, CountInt)> handler,
+								   CountInt amount,
+								   CountInt pos) const
+	{
+		for_each_int_point<std::function<void (IntPoint const &, CountInt)> &>(handler, amount, pos);
+	}
+	
+	std::vector<PointRange>
+	DigitalNet::split_range(CountInt amount,
+							CountInt pos,
+							CountInt parts)
+	{
+		std::vector<PointRange> ranges;
+		if ( amount == 0 )
+		{
+			return ranges;
+		}
+		
+		parts = std::max<CountInt>(parts, 1);
+		// size of a part, rounded up to a multiple of the alignment
+		CountInt part_size = amount/parts + (amount % parts != 0);
+		part_size += (range_alignment - part_size % range_alignment) % range_alignment;
+		
+		// the first inner boundary is the first aligned number after pos
+		CountInt boundary = pos + part_size - pos % range_alignment;
+		ranges.push_back({pos, std::min(amount, boundary - pos)});
+		while ( ranges.back().pos + ranges.back().amount < pos + amount )
+		{
+			CountInt const begin = ranges.back().pos + ranges.back().amount;
+			ranges.push_back({begin, std::min(part_size, pos + amount - begin)});
+		}
+		
+		return ranges;
+	}
+	
+	template <typename RealType>
+	void
+	DigitalNet::generate_block(CountInt  pos,
+							   CountInt  amount,
+							   RealType *out,
+							   Layout    layout) const
+	{
+		if ( amount == 0 )
+		{
+			return;
+		}
+
+		IntPoint curr_int(m_dim);
+		store_int_point(curr_int, pos);
+		if ( layout == Layout::point_major )
 		{
-			IntPoint curr_int(m_dim);
-			store_int_point(curr_int, pos);
-			handler(cast_int_point_to_real(curr_int), pos);
-			while ( --amount )
+			for (CountInt n = 0; ; )
 			{
-				++pos;
-				store_next_int_point(curr_int, pos, curr_int);
-				handler(cast_int_point_to_real(curr_int), pos);
+				if constexpr ( std::is_same_v<RealType, double> )
+				{
+					simd::int_to_double(out + n*m_dim, curr_int.data(), m_dim, static_cast<double>(m_recip));
+				}
+				else
+				{
+					store_real_point(out + n*m_dim, curr_int);
+				}
+				if ( ++n == amount )
+				{
+					break;
+				}
+				store_next_int_point(curr_int, pos + n, curr_int);
+			}
+		}
+		else
+		{
+			// coordinates are converted contiguously and then scattered with the stride of amount
+			std::vector<RealType> curr(m_dim);
+			for (CountInt n = 0; ; )
+			{
+				store_real_point(curr.data(), curr_int);
+				for (BasicInt i = 0; i < m_dim; ++i)
+				{
+					out[i*amount + n] = curr[i];
+				}
+				if ( ++n == amount )
+				{
+					break;
+				}
+				store_next_int_point(curr_int, pos + n, curr_int);
 			}
 		}
 	}
 	
+	template void DigitalNet::generate_block<float>      (CountInt, CountInt, float *,       Layout) const;
+	template void DigitalNet::generate_block<double>     (CountInt, CountInt, double *,      Layout) const;
+	template void DigitalNet::generate_block<long double>(CountInt, CountInt, long double *, Layout) const;
+
 	void
-	DigitalNet::for_each_int_point(std::function<void (IntPoint const &, CountInt)> handler,
-								   CountInt amount,
-								   CountInt pos) const
+	DigitalNet::save(std::string const &path) const
 	{
-		if ( amount != 0 )
+		save(path, netfile::NetKind::digital_net, std::vector<Polynomial>());
+	}
+	
+	void
+	DigitalNet::randomize(uint64_t      seed,
+						  uint64_t      counter,
+						  Randomization kind)
+	{
+		if ( m_nbits == 0 )
+		{
+			return;
+		}
+		
+		// independent streams of words for matrices and shifts of all dimensions
+		uint64_t const key = random::counter_word(seed, counter);
+		
+		if ( kind != Randomization::digital_shift )
 		{
-			IntPoint curr_int(m_dim);
-			store_int_point(curr_int, pos);
-			handler(curr_int, pos);
-			while ( --amount )
+			GenNumInt const *numbers = m_transposed_numbers.get();
+			auto table = std::make_shared< std::vector<GenNumInt> >(numbers, numbers + static_cast<std::size_t>(m_nbits)*m_dim);
+			std::vector<uint64_t> columns(m_nbits);
+			for (BasicInt i = 0; i < m_dim; ++i)
 			{
-				++pos;
-				store_next_int_point(curr_int, pos, curr_int);
-				handler(curr_int, pos);
+				// the j-th column of a unit lower triangular matrix has the unit in the j-th row and random digits below it
+				uint64_t const matrix_key = random::counter_word(random::counter_word(key, 0), i);
+				for (BasicInt j = 0; j < m_nbits; ++j)
+				{
+					uint64_t const diagonal = 1ULL << (m_nbits - 1 - j);
+					columns[j] = diagonal | (random::counter_word(matrix_key, j) & (diagonal - 1));
+				}
+				// the k-th generating number is the k-th column of the generating matrix, so it is multiplied as a vector
+				genmat::M4RMTable const product(columns.data(), m_nbits);
+				for (BasicInt k = 0; k < m_nbits; ++k)
+				{
+					(*table)[k*m_dim + i] = product((*table)[k*m_dim + i]);
+				}
+				// the previous shift is a part of the points being scrambled
+				if ( !m_shift.empty() )
+				{
+					m_shift[i] = product(m_shift[i]);
+				}
+			}
+			m_transposed_numbers = std::shared_ptr<GenNumInt const>(table, table->data());
+			if ( !m_generating_numbers.empty() )
+			{
+				for (BasicInt i = 0; i < m_dim; ++i)
+				{
+					m_generating_numbers[i] = generating_numbers(i);
+				}
+			}
+		}
+		
+		if ( kind != Randomization::matrix_scrambling )
+		{
+			m_shift.resize(m_dim, 0);
+			uint64_t const shift_key = random::counter_word(key, 1);
+			for (BasicInt i = 0; i < m_dim; ++i)
+			{
+				m_shift[i] ^= random::counter_word(shift_key, i) >> (max_nbits - m_nbits);
 			}
 		}
 	}
@@ -145,15 +300,53 @@ namespace tms
 	    m_dim(dim),
 	    m_recip( pow(2, -static_cast<Real>(m_nbits)) ),
 	    m_generating_numbers(generating_numbers)
+	{
+		update_transposed_numbers();
+	}
+	
+	DigitalNet::DigitalNet(netfile::Contents const &contents) :
+	    m_nbits(contents.header.nbits),
+	    m_dim(contents.header.dim),
+	    m_recip( pow(2, -static_cast<Real>(m_nbits)) ),
+	    m_generating_numbers(),
+	    m_transposed_numbers(contents.table)
 	{}
 	
+	void
+	DigitalNet::save(std::string             const &path,
+					 netfile::NetKind               kind,
+					 std::vector<Polynomial> const &irrpolys) const
+	{
+		if ( !m_shift.empty() )
+		{
+			throw std::logic_error("\nDigitally shifted nets can't be saved\n");
+		}
+		netfile::save(path, kind, m_nbits, m_dim, m_transposed_numbers.get(), irrpolys);
+	}
+	
+	void
+	DigitalNet::update_transposed_numbers(void)
+	{
+		auto table = std::make_shared< std::vector<GenNumInt> >(static_cast<std::size_t>(m_nbits)*m_dim, 0);
+		for (BasicInt i = 0; i < m_dim; ++i)
+		{
+			for (BasicInt k = 0; k < m_nbits; ++k)
+			{
+				(*table)[k*m_dim + i] = m_generating_numbers[i][k];
+			}
+		}
+		// the pointer to the data shares the ownership of the vector
+		m_transposed_numbers = std::shared_ptr<GenNumInt const>(table, table->data());
+	}
+	
 	void
 	DigitalNet::store_int_point(IntPoint &point,
 								CountInt  pos) const
 	{
+		// the shift is XORed once into the starting point, every following step of Gray's code keeps it
 		for (BasicInt i = 0; i < m_dim; ++i)
 		{
-			point[i] = 0;
+			point[i] = m_shift.empty() ? 0 : m_shift[i];
 		}
 		
 		CountInt pos_gray_code = (pos ^ (pos >> 1));
@@ -161,10 +354,7 @@ namespace tms
 		{
 			if ( pos_gray_code & 1 )
 			{
-				for (BasicInt i = 0; i < m_dim; ++i)
-				{
-					point[i] ^= m_generating_numbers[i][k];
-				}
+				simd::xor_rows(point.data(), point.data(), m_transposed_numbers.get() + k*m_dim, m_dim);
 			}
 			pos_gray_code >>= 1;
 		}
@@ -175,20 +365,10 @@ namespace tms
 									 CountInt        pos,
 									 IntPoint const &prev_point) const
 	{
-		// here we get pos = pow(2, rightmost zero bit position in pos), pos should be greater than 0
-		pos = ~(pos - 1) & pos;
+		// number of the only bit that differs in Gray's codes of pos - 1 and pos, pos should be greater than 0
+		BasicInt const   changed_bit = bitops::count_trailing_zeros(pos);
 		
-		// count trailing zeros of pos ( same that floor(log2(pos)) )
-		BasicInt rightmost_zero_bit_pos = 0;
-		while ( pos >>= 1 && rightmost_zero_bit_pos < (sizeof(CountInt)*8 - 1) )
-		{
-			++rightmost_zero_bit_pos;
-		}
-		
-		for (BasicInt i = 0; i < m_dim; ++i)
-		{
-			point[i] = prev_point[i] ^ m_generating_numbers[i][rightmost_zero_bit_pos];
-		}
+		simd::xor_rows(point.data(), prev_point.data(), m_transposed_numbers.get() + changed_bit*m_dim, m_dim);
 	}
 
 };
@@ -1,4 +1,5 @@
 #include "../include/tms-nets/niederreiter.hpp"
+#include "../include/tms-nets/details/parallel.hpp"
 
 
 namespace tms
@@ -19,7 +20,7 @@ namespace tms
 		m_irrpolys( (in_parallel ? gf2poly::generate_irrpolys_in_parallel : gf2poly::generate_irrpolys)(dim, nbits) )
 	{
 		check_init1(static_cast<void const *>(0));
-		initialize_generating_numbers();
+		initialize_generating_numbers(in_parallel);
 	}
 
 	Niederreiter::Niederreiter(BasicInt              const  nbits,
@@ -56,6 +57,17 @@ namespace tms
 	{}
 
 
+	Niederreiter::Niederreiter(std::string const &path) :
+		Niederreiter(netfile::load(path, netfile::NetKind::niederreiter))
+	{}
+
+
+	void
+	Niederreiter::save(std::string const &path) const
+	{
+		DigitalNet::save(path, netfile::NetKind::niederreiter, m_irrpolys);
+	}
+
 	BasicInt
 	Niederreiter::t_estimate(void) const
 	{
@@ -80,6 +92,16 @@ namespace tms
 		(this->*ptr_check)(ptr_arg);
 	}
 
+	Niederreiter::Niederreiter(netfile::Contents const &contents) :
+		DigitalNet(contents),
+		m_irrpolys(contents.irrpolys)
+	{
+		if ( m_irrpolys.size() != m_dim )
+		{
+			throw std::logic_error("\nAmount of polynomials in the file differs from the dimension of the net\n");
+		}
+	}
+
 	void Niederreiter::check_init1(void const *ptr_arg)
 	{
 		if ( m_nbits > max_nbits )
@@ -136,9 +158,9 @@ namespace tms
 //		// std::map was chosen for two reasons:
 //		// 1. it has been already included in gf2poly.hpp;
 //		// 2. we need to keep original order of polynomials.
-//		std::map<Polynomial, BasicInt, bool(*)(Polynomial const &, Polynomial const &)> just_set(irrpoly::operator!=);
+//		std::map<Polynomial, BasicInt, bool(*)(Polynomial const &, Polynomial const &)> just_set(operator!=);
 //		while ( i < m_irrpolys.size()  &&  just_set.size() == i && \
-//				quality_param <= m_nbits    &&  irrpoly::is_irreducible_berlekamp(m_irrpolys[i]) )
+//				quality_param <= m_nbits    &&  is_irreducible(m_irrpolys[i]) )
 //		{
 //			just_set.insert(std::make_pair(m_irrpolys[i], i));
 //			quality_param += m_irrpolys[i].size() - 2;
@@ -162,7 +184,7 @@ namespace tms
 		{
 			for (BasicInt j = i + 1; j < m_irrpolys.size() && all_are_coprime; ++j)
 			{
-				all_are_coprime = ( irrpoly::gcd(m_irrpolys[i], m_irrpolys[j]) == unit_poly );
+				all_are_coprime = ( gcd(m_irrpolys[i], m_irrpolys[j]) == unit_poly );
 			}
 			++i;
 		}
@@ -174,24 +196,42 @@ namespace tms
 	}
 
 	void
-	Niederreiter::initialize_generating_numbers(void)
+	Niederreiter::initialize_generating_numbers(bool in_parallel)
+	{
+		if ( in_parallel )
+		{
+			// dimensions are independent, each task initializes a range of them with its own scratch space
+			BasicInt const chunk_size   = std::max<BasicInt>(1, m_dim/(4*parallel::ThreadPool::global().size()));
+			BasicInt const chunks_count = (m_dim + chunk_size - 1)/chunk_size;
+			parallel::for_each_index(chunks_count, [&](std::size_t chunk_i) {
+				BasicInt const dim_begin = static_cast<BasicInt>(chunk_i)*chunk_size;
+				initialize_dimensions(dim_begin, std::min(dim_begin + chunk_size, m_dim));
+			});
+		}
+		else
+		{
+			initialize_dimensions(0, m_dim);
+		}
+		
+		update_transposed_numbers();
+	}
+
+	void
+	Niederreiter::initialize_dimensions(BasicInt dim_begin, BasicInt dim_end)
 	{
 		//std::cout << "Classical called\n";
-		std::vector<BasicInt> alpha(m_nbits + \
-									std::max_element(
-														m_irrpolys.begin(), \
-														m_irrpolys.end(), \
-														[](Polynomial const &lpoly, Polynomial const &rpoly) { return lpoly.degree() < rpoly.degree(); } \
-														)->degree() - 1);
+		std::vector<uint64_t> alpha;
+		// rows of the generating matrix, the j-th row is stored in the (m - 1 - j)-th word to be transposed into generating numbers
+		uint64_t              rows[max_nbits];
 		
-		for (BasicInt i = 0; i < m_dim; ++i)
+		for (BasicInt i = dim_begin; i < dim_end; ++i)
 		{
 			BasicInt const e       = static_cast<BasicInt>(m_irrpolys[i].degree());
 			BasicInt const r_nbits = m_nbits % e;
 			
 			Polynomial poly_mu(gf2poly::make_gf2poly({1}));
 			
-			alpha.resize(m_nbits - 1 + e);
+			std::fill(rows, rows + max_nbits, 0);
 			
 			for (BasicInt j = 0; j < m_nbits; )
 			{
@@ -200,22 +240,26 @@ namespace tms
 				poly_mu = poly_mu * m_irrpolys[i];
 				
 
-				recseq::fill_vector_recursively(alpha,
-												( r_nbits != 0 && j/e == (m_nbits - 1)/e ) ? 1ULL << (m_nbits - 1) : 1ULL << ((j/e + 1)*e - 1),
-												poly_mu);
+				recseq::fill_words_recursively(alpha,
+											   m_nbits - 1 + e,
+											   ( r_nbits != 0 && j/e == (m_nbits - 1)/e ) ? 1ULL << (m_nbits - 1) : 1ULL << ((j/e + 1)*e - 1),
+											   poly_mu);
 				
 				// Here we interpret the j-th digit of direction number g[i](k) as gamma[i](j,k) - an
 				// element of i-th generating matrix Gamma[i]
 				while ( rows_remaining_in_section != 0 )
 				{
-					for (BasicInt k = 0, r = j % e; k < m_nbits; ++k)
-					{
-						m_generating_numbers[i][k] |= static_cast<GenNumInt>(alpha[k + r]) << (m_nbits - 1 - j);
-					}
+					rows[m_nbits - 1 - j] = recseq::extract_terms(alpha, j % e, m_nbits);
 					++j;
 					--rows_remaining_in_section;
 				}
 			}
+			
+			bitops::transpose(rows);
+			for (BasicInt k = 0; k < m_nbits; ++k)
+			{
+				m_generating_numbers[i][k] = rows[k];
+			}
 		}
 	}
 
@@ -0,0 +1,199 @@
+/**
+ * @file    integrator.cpp
+ *
+ * @brief   Contains randomized Quasi Monte Carlo integration over digital nets.
+ */
+#include "../../include/tms-nets/qmc/integrator.hpp"
+
+#include "../../include/tms-nets/details/bitops.hpp"
+#include "../../include/tms-nets/details/parallel.hpp"
+#include "../../include/tms-nets/details/random.hpp"
+#include "../../include/tms-nets/details/simd.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+
+
+
+
+namespace
+{
+
+	/// Highest amount of values that pairwise summation adds one by one
+	std::size_t const  sc_pairwise_base_size   = 16;
+
+	/// Highest amount of terms of the continued fraction of the incomplete beta function
+	unsigned int const sc_beta_max_terms       = 300;
+
+	/// Amount of bisections in the search of quantiles, it is enough to reach the precision of double
+	unsigned int const sc_quantile_bisections  = 200;
+
+
+	/**
+	 * Returns the sum of values by pairwise summation: halves are summed recursively, so rounding errors grow
+	 * as \f$O(\log n)\f$ instead of \f$O(n)\f$, and the order of additions is fixed by the amount of values
+	 */
+	template <typename Value>
+	tms::Real pairwise_sum(Value const *values, std::size_t count)
+	{
+		if ( count <= sc_pairwise_base_size )
+		{
+			tms::Real sum = 0;
+			for (std::size_t i = 0; i < count; ++i)
+				sum += values[i];
+			return sum;
+		}
+		std::size_t const half = count/2;
+		return pairwise_sum(values, half) + pairwise_sum(values + half, count - half);
+	}
+
+	/// Returns the continued fraction of the regularized incomplete beta function by the modified Lentz's method
+	double beta_continued_fraction(double a, double b, double x)
+	{
+		double const tiny = 1e-300;
+		double c = 1;
+		double d = 1 - (a + b)*x/(a + 1);
+		d = 1/(std::abs(d) < tiny ? tiny : d);
+		double fraction = d;
+		for (unsigned int term = 1; term <= sc_beta_max_terms; ++term)
+		{
+			// even and odd terms of the fraction
+			for (double numerator : {term*(b - term)*x/((a + 2*term - 1)*(a + 2*term)),
+			                         -(a + term)*(a + b + term)*x/((a + 2*term)*(a + 2*term + 1))})
+			{
+				d = 1 + numerator*d;
+				d = 1/(std::abs(d) < tiny ? tiny : d);
+				c = 1 + numerator/c;
+				c = std::abs(c) < tiny ? tiny : c;
+				fraction *= c*d;
+			}
+			if ( std::abs(c*d - 1) < 1e-16 )
+				break;
+		}
+		return fraction;
+	}
+
+	/// Returns the regularized incomplete beta function \f$I_x(a, b)\f$
+	double incomplete_beta(double a, double b, double x)
+	{
+		if ( x <= 0 || x >= 1 )
+			return x <= 0 ? 0 : 1;
+		double const factor = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a*std::log(x) + b*std::log(1 - x));
+		// the fraction converges fast for x below the mean of the distribution, so the symmetry is used above it
+		if ( x < (a + 1)/(a + b + 2) )
+			return factor*beta_continued_fraction(a, b, x)/a;
+		return 1 - factor*beta_continued_fraction(b, a, 1 - x)/b;
+	}
+
+	/**
+	 * Returns \f$q\f$ such that \f$P(|T| \le q) = confidence\f$ for Student's \f$T\f$ with the given degrees of freedom.
+	 * For \f$z = \nu/(\nu + q^2)\f$ it holds \f$P(|T| > q) = I_z(\nu/2, 1/2)\f$, which increases with \f$z\f$, so \f$z\f$
+	 * is found by bisection.
+	 */
+	double student_quantile(double confidence, double freedom)
+	{
+		double lower = 0;
+		double upper = 1;
+		for (unsigned int bisection = 0; bisection < sc_quantile_bisections; ++bisection)
+		{
+			double const middle = (lower + upper)/2;
+			(incomplete_beta(freedom/2, 0.5, middle) < 1 - confidence ? lower : upper) = middle;
+		}
+		double const z = (lower + upper)/2;
+		return std::sqrt(freedom*(1 - z)/z);
+	}
+
+}
+
+
+
+
+
+tms::qmc::Integrator::Integrator(DigitalNet const &net,
+								 BasicInt          replicates,
+								 uint64_t          seed,
+								 std::size_t       block_size) :
+	m_net(net),
+	m_replicates(replicates),
+	m_seed(seed),
+	m_block_size(block_size)
+{
+	if ( replicates < 2 )
+		throw std::invalid_argument("\nAt least 2 replicates are needed to estimate the error\n");
+	if ( block_size == 0 )
+		throw std::invalid_argument("\nSize of blocks must be positive\n");
+}
+
+tms::qmc::Estimate tms::qmc::Integrator::integrate(Integrand const &integrand, Real confidence) const
+{
+	if ( !(confidence > 0 && confidence < 1) )
+		throw std::invalid_argument("\nConfidence level must be from (0, 1)\n");
+
+	BasicInt const    s            = m_net.s();
+	BasicInt const    m            = m_net.m();
+	CountInt const    point_count  = CountInt(1) << m;
+	std::size_t const blocks_count = (point_count + m_block_size - 1)/m_block_size;
+	// digits of points below 2^(-m) are zero, they are filled with random digits as well, so that every point
+	// of a replicate is uniformly distributed and estimates are unbiased
+	BasicInt const    nbits        = std::max<BasicInt>(m, bitops::exact_double_bits);
+	BasicInt const    low_nbits    = nbits - m;
+	double const      recip        = std::ldexp(1.0, -static_cast<int>(nbits));
+
+	// 1. Scrambled and shifted copies of the net and random low digits of replicates, nets and low digits are
+	//    computed from different keys
+	std::vector<DigitalNet> nets(m_replicates, m_net);
+	std::vector<GenNumInt>  low_digits(static_cast<std::size_t>(m_replicates)*s, 0);
+	parallel::for_each_index(m_replicates, [&](std::size_t replicate_i) {
+		nets[replicate_i].randomize(random::counter_word(m_seed, 0), replicate_i);
+		uint64_t const low_key = random::counter_word(random::counter_word(m_seed, 1), replicate_i);
+		for (BasicInt k = 0; k < s && low_nbits != 0; ++k)
+			low_digits[replicate_i*s + k] = random::counter_word(low_key, k) >> (64 - low_nbits);
+	});
+
+	// 2. Evaluate blocks of all replicates in parallel and sum values of each block
+	std::vector<Real> block_sums(m_replicates*blocks_count);
+	parallel::for_each_index(block_sums.size(), [&](std::size_t task_i) {
+		std::size_t const replicate_i = task_i/blocks_count;
+		CountInt const    pos         = (task_i % blocks_count)*m_block_size;
+		std::size_t const amount      = std::min<CountInt>(m_block_size, point_count - pos);
+		GenNumInt const  *low         = low_digits.data() + replicate_i*s;
+		std::vector<double>    points(amount*s);
+		std::vector<double>    values(amount);
+		std::vector<GenNumInt> digits(s);
+		nets[replicate_i].for_each_int_point([&](IntPoint const &point, CountInt point_i) {
+			for (BasicInt k = 0; k < s; ++k)
+				digits[k] = (point[k] << low_nbits) | low[k];
+			simd::int_to_double(points.data() + (point_i - pos)*s, digits.data(), s, recip);
+		}, amount, pos);
+		integrand(points.data(), amount, values.data());
+		block_sums[task_i] = pairwise_sum(values.data(), amount);
+	});
+
+	// 3. Sum blocks of each replicate in a fixed order and estimate the error by the spread of replicates
+	Estimate result;
+	result.replicates.resize(m_replicates);
+	for (BasicInt replicate_i = 0; replicate_i < m_replicates; ++replicate_i)
+		result.replicates[replicate_i] = pairwise_sum(block_sums.data() + replicate_i*blocks_count, blocks_count)/point_count;
+	result.mean = pairwise_sum(result.replicates.data(), m_replicates)/m_replicates;
+	std::vector<Real> squares(m_replicates);
+	for (BasicInt replicate_i = 0; replicate_i < m_replicates; ++replicate_i)
+		squares[replicate_i] = (result.replicates[replicate_i] - result.mean)*(result.replicates[replicate_i] - result.mean);
+	result.standard_error = std::sqrt(pairwise_sum(squares.data(), m_replicates)/(m_replicates - 1)/m_replicates);
+
+	Real const half_width = student_quantile(static_cast<double>(confidence), m_replicates - 1)*result.standard_error;
+	result.lower = result.mean - half_width;
+	result.upper = result.mean + half_width;
+	return result;
+}
+
+tms::BasicInt tms::qmc::Integrator::replicates(void) const
+{
+	return m_replicates;
+}
+
+uint64_t tms::qmc::Integrator::seed(void) const
+{
+	return m_seed;
+}
@@ -19,7 +19,7 @@ namespace tms
 				 &Sobol::check_init1,
 				 (void *)0)
 	{
-		initialize_generating_numbers();
+		initialize_generating_numbers(in_parallel);
 	}
 	
 	Sobol::Sobol(BasicInt              const  nbits,
@@ -58,26 +58,34 @@ namespace tms
 		Sobol(nbits, std::vector< std::vector<uintmax_t> >{irrpolys_coeffs})
 	{}
 	
+	Sobol::Sobol(std::string const &path) :
+		Niederreiter(netfile::load(path, netfile::NetKind::sobol))
+	{}
 	
 	
 	void
-	Sobol::initialize_generating_numbers(void)
+	Sobol::save(std::string const &path) const
 	{
-		std::vector<BasicInt> alpha(m_nbits + \
-									std::max_element(
-													 m_irrpolys.begin(), \
-													 m_irrpolys.end(), \
-													 [](Polynomial const &lpoly, Polynomial const &rpoly) { return lpoly.degree() < rpoly.degree(); } \
-													 )->degree() - 1);
+		DigitalNet::save(path, netfile::NetKind::sobol, m_irrpolys);
+	}
+	
+	
+	
+	void
+	Sobol::initialize_dimensions(BasicInt dim_begin, BasicInt dim_end)
+	{
+		std::vector<uint64_t> alpha;
+		// rows of the generating matrix, the j-th row is stored in the (m - 1 - j)-th word to be transposed into generating numbers
+		uint64_t              rows[max_nbits];
 		
-		for (BasicInt i = 0; i < m_dim; ++i)
+		for (BasicInt i = dim_begin; i < dim_end; ++i)
 		{
 			BasicInt const e       = static_cast<BasicInt>(m_irrpolys[i].degree());
 			BasicInt const r_nbits = m_nbits % e;
 			
 			Polynomial poly_mu(tms::gf2poly::make_gf2poly({1}));
 			
-			alpha.resize(m_nbits - 1 + e);
+			std::fill(rows, rows + max_nbits, 0);
 			
 			for (BasicInt j = 0; j < m_nbits; )
 			{
@@ -86,23 +94,23 @@ namespace tms
 				poly_mu = poly_mu * m_irrpolys[i];
 				
 				
-				recseq::fill_vector_recursively(alpha, 1ULL << ((j/e + 1)*e - 1), poly_mu);
+				recseq::fill_words_recursively(alpha, m_nbits - 1 + e, 1ULL << ((j/e + 1)*e - 1), poly_mu);
 				
 				// Here we interpret the j-th digit of direction number g[i](k) as gamma[i](j,k) - an
 				// element of i-th generating matrix Gamma[i]
 				while ( rows_remaining_in_section != 0 )
 				{
-					for (BasicInt k = 0, r = e - 1 - (j % e);
-						 k < m_nbits;
-						 ++k)
-					{
-						m_generating_numbers[i].set_bit(j, k, alpha[k + r]);
-						//m_generating_numbers[i][k] |= static_cast<GenNumInt>(alpha[k + r]) << (m_nbits - 1 - j);
-					}
+					rows[m_nbits - 1 - j] = recseq::extract_terms(alpha, e - 1 - (j % e), m_nbits);
 					++j;
 					--rows_remaining_in_section;
 				}
 			}
+			
+			bitops::transpose(rows);
+			for (BasicInt k = 0; k < m_nbits; ++k)
+			{
+				m_generating_numbers[i][k] = rows[k];
+			}
 		}
 	}
 	
@@ -114,7 +122,7 @@ namespace tms
 		
 		Polynomial const &poly = m_irrpolys[dim];
 		
-		auto exp_poly = [&](irrpoly::gfpoly const &poly, BasicInt degree) -> Polynomial {
+		auto exp_poly = [&](Polynomial const &poly, BasicInt degree) -> Polynomial {
 			Polynomial cur_poly = gf2poly::make_gf2poly({1});
 			while ( degree > 0 )
 			{
@@ -128,9 +136,9 @@ namespace tms
 		for (BasicInt i = 0; i < m_nbits; ++i)
 		{
 			cur_poly = exp_poly(omega, i % poly.degree())*exp_poly(poly, i/poly.degree());
-			for (BasicInt j = 0; j < cur_poly.value().size(); ++j)
+			for (BasicInt j = 0; j < cur_poly.size(); ++j)
 			{
-				dir_num[i] |= (cur_poly.value()[j]) << (m_nbits - 1 - j);
+				dir_num[i] |= cur_poly[j] << (m_nbits - 1 - j);
 			}
 		}
 		
@@ -0,0 +1,70 @@
+/**
+ * \file
+ *       bench_DigitalNet.cpp
+ *
+ * \brief
+ *       Benchmarks of point generation. Hidden by default, run with the "[benchmark]" filter.
+ */
+#include "../catch2/catch_amalgamated.hpp"
+#include "../../include/tms-nets.hpp"
+
+#include <atomic>
+
+
+
+
+
+TEST_CASE("Point generation throughput", "[.][benchmark][DigitalNet]")
+{
+	tms::Sobol const    net(16, 8);
+	tms::CountInt const amount = tms::CountInt(1) << net.m();
+	std::vector<double> block(amount * net.s());
+	std::vector<float>  block_float(amount * net.s());
+
+	BENCHMARK("for_each_point, std::function handler")
+	{
+		tms::Real sum = 0;
+		std::function<void (tms::Point const &, tms::CountInt)> handler = [&sum](tms::Point const &point, tms::CountInt) { sum += point[0]; };
+		net.for_each_point(handler, amount);
+		return sum;
+	};
+
+	BENCHMARK("for_each_point, inlined handler")
+	{
+		tms::Real sum = 0;
+		net.for_each_point([&sum](tms::Point const &point, tms::CountInt) { sum += point[0]; }, amount);
+		return sum;
+	};
+
+	BENCHMARK("for_each_point<double>, inlined handler")
+	{
+		double sum = 0;
+		net.for_each_point<double>([&sum](std::vector<double> const &point, tms::CountInt) { sum += point[0]; }, amount);
+		return sum;
+	};
+
+	BENCHMARK("for_each_point_parallel<double>, inlined handler")
+	{
+		std::atomic<tms::CountInt> count(0);
+		net.for_each_point_parallel<double>([&count](std::vector<double> const &point, tms::CountInt) { if ( point[0] < 0.0 ) { ++count; } }, amount);
+		return count.load();
+	};
+
+	BENCHMARK("generate_block, point-major")
+	{
+		net.generate_block(0, amount, block.data(), tms::Layout::point_major);
+		return block[0];
+	};
+
+	BENCHMARK("generate_block<float>, point-major")
+	{
+		net.generate_block(0, amount, block_float.data(), tms::Layout::point_major);
+		return block_float[0];
+	};
+
+	BENCHMARK("generate_block, dimension-major")
+	{
+		net.generate_block(0, amount, block.data(), tms::Layout::dimension_major);
+		return block[0];
+	};
+}
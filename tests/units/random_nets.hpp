@@ -0,0 +1,51 @@
+/**
+ * \file
+ *       random_nets.hpp
+ *
+ * \brief
+ *       Random nondegenerate generating matrices and digital nets shared by unit tests.
+ */
+#ifndef TMS_NETS_TESTS_RANDOM_NETS_HPP
+#define TMS_NETS_TESTS_RANDOM_NETS_HPP
+
+#include "../../include/tms-nets.hpp"
+
+#include <random>
+#include <vector>
+
+
+
+
+
+/// Returns a product of random unit lower and upper triangular matrices, such products are nondegenerate
+inline tms::GenMat random_nondegenerate_matrix(tms::BasicInt size, std::mt19937_64 &engine)
+{
+	tms::GenMat lower(size);
+	tms::GenMat upper(size);
+	for (tms::BasicInt i = 0; i < size; ++i)
+	{
+		for (tms::BasicInt j = 0; j < size; ++j)
+		{
+			lower[i][j] = j < i ? engine() & 1 : (j == i);
+			upper[i][j] = j > i ? engine() % 3 == 0 : (j == i);
+		}
+	}
+	return lower * upper;
+}
+
+/// Returns a digital net with random nondegenerate generating matrices
+inline tms::DigitalNet random_net(tms::BasicInt m, tms::BasicInt s, std::mt19937_64 &engine)
+{
+	std::vector<tms::GenMat> matrices;
+	for (tms::BasicInt dim = 0; dim < s; ++dim)
+	{
+		matrices.push_back(random_nondegenerate_matrix(m, engine));
+	}
+	return tms::DigitalNet(matrices);
+}
+
+
+
+
+
+#endif // #ifndef TMS_NETS_TESTS_RANDOM_NETS_HPP
@@ -0,0 +1,104 @@
+/**
+ * \file
+ *       unit_BitPoly.cpp
+ */
+#include "../catch2/catch_amalgamated.hpp"
+#include "../../include/tms-nets.hpp"
+
+#include <random>
+
+
+
+
+
+TEST_CASE("Validation of BitPoly class", "[details][BitPoly]")
+{
+	std::mt19937_64 engine(20210915);
+	auto random_coeffs = [&](std::size_t count) {
+		std::vector<uintmax_t> coeffs(count);
+		for (uintmax_t &coeff : coeffs)
+		{
+			coeff = engine() & 1;
+		}
+		coeffs.back() = 1;
+		return coeffs;
+	};
+
+	SECTION("Check degree and coefficients")
+	{
+		tms::BitPoly const poly({1, 0, 1, 1, 0, 0});
+		CHECK( poly.size() == 4 );
+		CHECK( poly.degree() == 3 );
+		CHECK( poly == tms::BitPoly(13) );
+		CHECK( poly[2] == 1 );
+		CHECK( poly[100] == 0 );
+		CHECK( tms::BitPoly().size() == 0 );
+		CHECK_THROWS( tms::BitPoly().degree() );
+		CHECK( (tms::BitPoly(1) << 100).degree() == 100 );
+		CHECK( ((tms::BitPoly(5) << 130) >> 130) == tms::BitPoly(5) );
+	}
+
+	SECTION("Check multiplication against convolution of coefficients")
+	{
+		for (std::size_t l_size : {1, 5, 64, 65, 200})
+		{
+			for (std::size_t r_size : {1, 63, 64, 130})
+			{
+				std::vector<uintmax_t> const l_coeffs = random_coeffs(l_size);
+				std::vector<uintmax_t> const r_coeffs = random_coeffs(r_size);
+				std::vector<uintmax_t>       product_coeffs(l_size + r_size - 1, 0);
+				for (std::size_t i = 0; i < l_size; ++i)
+				{
+					for (std::size_t j = 0; j < r_size; ++j)
+					{
+						product_coeffs[i + j] ^= l_coeffs[i] & r_coeffs[j];
+					}
+				}
+				CHECK( tms::BitPoly(l_coeffs)*tms::BitPoly(r_coeffs) == tms::BitPoly(product_coeffs) );
+			}
+		}
+	}
+
+	SECTION("Check division with remainder and gcd")
+	{
+		for (std::size_t size : {3, 40, 64, 100, 190})
+		{
+			tms::BitPoly const divisor(random_coeffs(size));
+			tms::BitPoly const quotient(random_coeffs(size + 17));
+			tms::BitPoly const remainder = tms::BitPoly(random_coeffs(size - 1)) >> 1;
+
+			auto const result = tms::divide(quotient*divisor + remainder, divisor);
+			CHECK( result.first == quotient );
+			CHECK( result.second == remainder );
+
+			tms::BitPoly const common = tms::BitPoly(random_coeffs(size)) << 3;
+			tms::BitPoly const g = tms::gcd(divisor*common, quotient*common);
+			CHECK( (g % common).is_zero() );
+			CHECK( (divisor*common % g).is_zero() );
+			CHECK( (quotient*common % g).is_zero() );
+		}
+		CHECK_THROWS( tms::BitPoly(7) / tms::BitPoly() );
+	}
+
+	SECTION("Check irreducibility test")
+	{
+		// amounts of irreducible polynomials over GF(2) of degrees 1, ..., 12
+		std::vector<unsigned int> const counts = {2, 1, 2, 3, 6, 9, 18, 30, 56, 99, 186, 335};
+		for (unsigned int degree = 1; degree <= counts.size(); ++degree)
+		{
+			unsigned int count = 0;
+			for (uint64_t number = 1ULL << degree; number < 2ULL << degree; ++number)
+			{
+				count += tms::is_irreducible(tms::BitPoly(number));
+			}
+			CHECK( count == counts[degree - 1] );
+		}
+
+		tms::BitPoly const trinomial = (tms::BitPoly(1) << 127) + tms::BitPoly(3);
+		tms::BitPoly const pentanomial = (tms::BitPoly(1) << 64) + tms::BitPoly(27);
+		CHECK( tms::is_irreducible(trinomial) );
+		CHECK( tms::is_irreducible(pentanomial) );
+		CHECK_FALSE( tms::is_irreducible(trinomial*pentanomial) );
+		CHECK_FALSE( tms::is_irreducible(pentanomial*tms::BitPoly(7)) );
+	}
+}
@@ -7,6 +7,17 @@
  */
 #include "../catch2/catch_amalgamated.hpp"
 #include "../../include/tms-nets.hpp"
+#include "random_nets.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <random>
+#include <string>
 
 
 
@@ -79,4 +90,602 @@ TEST_CASE("Validation of DigitalNet class", "[nets][DigitalNet]")
 		CHECK( point[1] == 6 );
 		CHECK( point[2] == 2 );
 	}
+
+	SECTION("Generation of a block of points (both layouts)")
+	{
+		std::vector<double> point_major(6 * 3);
+		std::vector<double> dimension_major(6 * 3);
+		nondeg_net.generate_block(2, 6, point_major.data(), tms::Layout::point_major);
+		nondeg_net.generate_block(2, 6, dimension_major.data(), tms::Layout::dimension_major);
+		for (tms::CountInt n = 0; n < 6; ++n)
+		{
+			tms::Point point = nondeg_net.generate_point(2 + n);
+			for (tms::BasicInt i = 0; i < 3; ++i)
+			{
+				CHECK( point_major[n * 3 + i] == Catch::Approx(point[i]).margin(0.0001) );
+				CHECK( dimension_major[i * 6 + n] == Catch::Approx(point[i]).margin(0.0001) );
+			}
+		}
+	}
+
+	SECTION("Generation of points with float and double coordinates")
+	{
+		std::vector<float> block(8 * 3);
+		nondeg_net.generate_block(0, 8, block.data());
+		nondeg_net.for_each_point<double>([&](std::vector<double> const &point, tms::CountInt pos)
+		{
+			tms::IntPoint int_point = nondeg_net.generate_int_point(pos);
+			for (tms::BasicInt i = 0; i < 3; ++i)
+			{
+				CHECK( point[i] == int_point[i] / 8.0 );
+				CHECK( block[pos * 3 + i] == int_point[i] / 8.0f );
+			}
+		}, 8);
+	}
+
+	SECTION("Sequential generation with an arbitrary callable")
+	{
+		tms::CountInt visited = 0;
+		nondeg_net.for_each_point([&](auto const &point, tms::CountInt pos)
+		{
+			tms::Point expected = nondeg_net.generate_point(pos);
+			CHECK( point == expected );
+			++visited;
+		}, 8);
+		CHECK( visited == 8 );
+		nondeg_net.for_each_int_point([&](auto const &int_point, tms::CountInt pos)
+		{
+			CHECK( int_point == nondeg_net.generate_int_point(pos) );
+		}, 5, 3);
+	}
+}
+
+
+
+TEST_CASE("Validation of DigitalNet class, high-dimensional net", "[nets][DigitalNet]")
+{
+	// full-width pseudo-random generating numbers exercise every lane and tail of the vectorized kernels
+	tms::BasicInt const      nbits = tms::max_nbits;
+	tms::BasicInt const      dim   = 37;
+	std::vector<tms::GenNum> generating_numbers(dim, tms::GenNum(nbits));
+	uint64_t                 state = 0x9E3779B97F4A7C15ULL;
+	for (tms::BasicInt i = 0; i < dim; ++i)
+	{
+		for (tms::BasicInt k = 0; k < nbits; ++k)
+		{
+			state = state * 6364136223846793005ULL + 1442695040888963407ULL;
+			generating_numbers[i][k] = state;
+		}
+	}
+	tms::DigitalNet net(generating_numbers);
+
+	SECTION("Gray code stepping matches direct construction")
+	{
+		net.for_each_int_point([&](tms::IntPoint const &point, tms::CountInt pos)
+		{
+			CHECK( point == net.generate_int_point(pos) );
+		}, 100, 1000);
+	}
+
+	SECTION("Parallel generation gives the same points as sequential one")
+	{
+		tms::CountInt const amount = 1000;
+		tms::CountInt const pos    = 77;
+		std::vector<tms::IntPoint> points(amount);
+		net.for_each_int_point_parallel([&](tms::IntPoint const &point, tms::CountInt point_pos)
+		{
+			points[point_pos - pos] = point;
+		}, amount, pos, 4);
+		net.for_each_int_point([&](tms::IntPoint const &point, tms::CountInt point_pos)
+		{
+			CHECK( points[point_pos - pos] == point );
+		}, amount, pos);
+	}
+
+	SECTION("Splitting of a section into parts")
+	{
+		std::vector<tms::PointRange> ranges = tms::DigitalNet::split_range(1000, 77, 4);
+		REQUIRE( ranges.size() == 4 );
+		CHECK( ranges.front().pos == 77 );
+		for (std::size_t i = 1; i < ranges.size(); ++i)
+		{
+			CHECK( ranges[i].pos == ranges[i - 1].pos + ranges[i - 1].amount );
+			CHECK( ranges[i].pos % tms::DigitalNet::range_alignment == 0 );
+		}
+		CHECK( ranges.back().pos + ranges.back().amount == 1077 );
+	}
+
+	SECTION("Conversion to double is correctly rounded")
+	{
+		std::vector<double> block(100 * dim);
+		net.generate_block(1000, 100, block.data());
+		for (tms::CountInt n = 0; n < 100; ++n)
+		{
+			tms::IntPoint point = net.generate_int_point(1000 + n);
+			for (tms::BasicInt i = 0; i < dim; ++i)
+			{
+				CHECK( block[n * dim + i] == std::ldexp(static_cast<double>(point[i]), -static_cast<int>(nbits)) );
+			}
+		}
+	}
+}
+
+
+
+TEST_CASE("Validation of DigitalNet class, saving and loading of nets", "[nets][DigitalNet]")
+{
+	std::string const path = (std::filesystem::temp_directory_path() / "tms_nets_unit_test.net").string();
+	tms::Sobol const  sobol_net(32, 10);
+	REQUIRE_NOTHROW( sobol_net.save(path) );
+
+	SECTION("Loaded net is the same as the saved one")
+	{
+		tms::Sobol const      loaded_sobol(path);
+		tms::DigitalNet const loaded_net(path);
+		REQUIRE( loaded_sobol.m() == sobol_net.m() );
+		REQUIRE( loaded_sobol.s() == sobol_net.s() );
+		REQUIRE( loaded_net.s() == sobol_net.s() );
+		for (tms::BasicInt dim = 0; dim < sobol_net.s(); ++dim)
+		{
+			CHECK( loaded_sobol.generating_numbers(dim) == sobol_net.generating_numbers(dim) );
+			CHECK( loaded_sobol.inversed_generating_numbers(dim) == sobol_net.inversed_generating_numbers(dim) );
+			CHECK( loaded_net.generating_matrix(dim) == sobol_net.generating_matrix(dim) );
+		}
+		CHECK( loaded_sobol.t_estimate() == sobol_net.t_estimate() );
+		CHECK( loaded_net.generate_point(1234567) == sobol_net.generate_point(1234567) );
+		CHECK( loaded_net.generate_point_classical(77) == sobol_net.generate_point_classical(77) );
+
+		// the mapped table outlives the net it was loaded by
+		tms::DigitalNet copied_net;
+		{
+			tms::DigitalNet const temporary_net(path);
+			copied_net = temporary_net;
+		}
+		CHECK( copied_net.generate_int_point(99) == sobol_net.generate_int_point(99) );
+	}
+
+	SECTION("Files of other kinds and formats are rejected")
+	{
+		CHECK_THROWS_AS( tms::Niederreiter(path), std::logic_error );
+
+		std::vector<tms::GenNum> const numbers = {tms::GenNum({1, 2, 4}), tms::GenNum({4, 2, 1})};
+		tms::DigitalNet(numbers).save(path);
+		CHECK( tms::DigitalNet(path).generating_numbers(1) == numbers[1] );
+		CHECK_THROWS_AS( tms::Sobol(path), std::logic_error );
+
+		std::ofstream(path, std::ios::binary) << "not a net, but a long enough text to contain the header of a net....";
+		CHECK_THROWS_AS( tms::DigitalNet(path), std::logic_error );
+		CHECK_THROWS( tms::DigitalNet(path + ".missing") );
+	}
+
+	SECTION("Headers with offsets and amounts out of the file are rejected")
+	{
+		// rewrites the header of a valid file
+		auto patch_header = [&path](std::function<void (tms::netfile::Header &)> const &patch) {
+			tms::Sobol(10, 3).save(path);
+			std::string contents;
+			{
+				std::ifstream file(path, std::ios::binary);
+				contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+			}
+			tms::netfile::Header header;
+			std::memcpy(&header, contents.data(), sizeof(header));
+			patch(header);
+			std::memcpy(&contents[0], &header, sizeof(header));
+			std::ofstream(path, std::ios::binary | std::ios::trunc).write(contents.data(), static_cast<std::streamsize>(contents.size()));
+		};
+
+		// table_offset + table_size wraps around to polys_offset, no polynomials hide the table out of the file
+		patch_header([](tms::netfile::Header &header) {
+			header.table_offset = ~0ULL - 191;
+			header.polys_offset = 48;
+			header.polys_count  = 0;
+		});
+		CHECK_THROWS_AS( tms::DigitalNet(path), std::logic_error );
+
+		patch_header([](tms::netfile::Header &header) { header.polys_count = 1ULL << 50; });
+		CHECK_THROWS_AS( tms::Sobol(path), std::logic_error );
+
+		patch_header([](tms::netfile::Header &header) { header.nbits = ~0U; });
+		CHECK_THROWS_AS( tms::DigitalNet(path), std::logic_error );
+
+		patch_header([](tms::netfile::Header &) {});
+		CHECK( tms::Sobol(path).generate_int_point(100) == tms::Sobol(10, 3).generate_int_point(100) );
+	}
+
+	std::filesystem::remove(path);
+}
+
+
+
+TEST_CASE("Validation of DigitalNet class, randomization", "[nets][DigitalNet]")
+{
+	tms::Sobol const net(12, 5);
+
+	SECTION("Digital shift XORs the same digits into every point")
+	{
+		tms::Sobol shifted_net = net;
+		shifted_net.randomize(20211101, 0, tms::Randomization::digital_shift);
+		REQUIRE( shifted_net.is_shifted() );
+		CHECK_FALSE( net.is_shifted() );
+		tms::IntPoint const shift = shifted_net.generate_int_point(0);
+		for (tms::BasicInt dim = 0; dim < net.s(); ++dim)
+		{
+			CHECK( shifted_net.generating_numbers(dim) == net.generating_numbers(dim) );
+			CHECK( shift[dim] < (tms::GenNumInt(1) << net.m()) );
+		}
+		shifted_net.for_each_int_point([&](tms::IntPoint const &point, tms::CountInt pos) {
+			tms::IntPoint expected = net.generate_int_point(pos);
+			for (tms::BasicInt dim = 0; dim < net.s(); ++dim)
+				expected[dim] ^= shift[dim];
+			REQUIRE( point == expected );
+		}, 1000, 3000);
+		CHECK( shifted_net.generate_point_classical(1234 ^ (1234 >> 1)) == shifted_net.generate_point(1234) );
+	}
+
+	SECTION("Matrix scrambling multiplies generating matrices by unit lower triangular matrices")
+	{
+		tms::Sobol scrambled_net = net;
+		scrambled_net.randomize(20211101, 0, tms::Randomization::matrix_scrambling);
+		CHECK_FALSE( scrambled_net.is_shifted() );
+		CHECK( scrambled_net.generate_int_point(0) == tms::IntPoint(net.s(), 0) );
+		for (tms::BasicInt dim = 0; dim < net.s(); ++dim)
+		{
+			tms::GenMat const scrambling = scrambled_net.generating_matrix(dim)*net.generating_matrix(dim).inverse();
+			for (tms::BasicInt row = 0; row < net.m(); ++row)
+			{
+				CHECK( scrambling[row][row] == 1 );
+				for (tms::BasicInt column = row + 1; column < net.m(); ++column)
+					CHECK( scrambling[row][column] == 0 );
+			}
+		}
+		CHECK_FALSE( scrambled_net.generating_matrix(3) == net.generating_matrix(3) );
+	}
+
+	SECTION("Randomized nets keep their t-value and equidistribution")
+	{
+		tms::Niederreiter const niederreiter_net(10, 4);
+		tms::BasicInt const     t = tms::analysis::t(niederreiter_net);
+		for (std::uint64_t counter = 0; counter < 4; ++counter)
+		{
+			tms::Niederreiter randomized_net = niederreiter_net;
+			randomized_net.randomize(7, counter);
+			CHECK( tms::analysis::t(randomized_net) == t );
+			CHECK( tms::analysis::verify_equidistribution(randomized_net, t).equidistributed );
+		}
+	}
+
+	SECTION("Randomizations are reproducible and independent of the order of creation")
+	{
+		std::vector<tms::DigitalNet> nets(8, net);
+		tms::parallel::for_each_index(nets.size(), [&](std::size_t counter) { nets[counter].randomize(42, counter); });
+		for (std::uint64_t counter = nets.size(); counter-- > 0;)
+		{
+			tms::DigitalNet same_net = net;
+			same_net.randomize(42, counter);
+			CHECK( same_net.generate_int_point(777) == nets[counter].generate_int_point(777) );
+			CHECK( same_net.generating_numbers(4) == nets[counter].generating_numbers(4) );
+		}
+		CHECK( nets[0].generate_int_point(777) != nets[1].generate_int_point(777) );
+		CHECK( net.generate_int_point(777) == tms::Sobol(12, 5).generate_int_point(777) );
+
+		// points of a randomized net are the same for all ways of generation
+		std::vector<double> block(256*net.s());
+		nets[5].generate_block(100, 256, block.data());
+		nets[5].for_each_point_parallel<double>([&](std::vector<double> const &point, tms::CountInt pos) {
+			for (tms::BasicInt dim = 0; dim < net.s(); ++dim)
+				REQUIRE( point[dim] == block[(pos - 100)*net.s() + dim] );
+		}, 256, 100);
+	}
+
+	SECTION("Shifted nets can't be saved")
+	{
+		tms::Sobol shifted_net = net;
+		shifted_net.randomize(1, 1);
+		CHECK_THROWS_AS( shifted_net.save((std::filesystem::temp_directory_path() / "tms_nets_unit_test_shifted.net").string()), std::logic_error );
+	}
+}
+
+
+
+TEST_CASE("Validation of t-value computation", "[analysis][DigitalNet]")
+{
+	// the net is a (t, m, s)-net iff for every d_1 + ... + d_s = m - t the first d_i rows of all matrices are independent
+	auto rank = [](std::vector<uint64_t> rows) {
+		std::size_t result = 0;
+		for (std::size_t i = 0; i < rows.size(); ++i)
+		{
+			if ( rows[i] == 0 )
+			{ continue; }
+			++result;
+			uint64_t const pivot = rows[i] & (~rows[i] + 1);
+			for (std::size_t j = i + 1; j < rows.size(); ++j)
+			{
+				rows[j] ^= (rows[j] & pivot) ? rows[i] : 0;
+			}
+		}
+		return result;
+	};
+	auto is_net_with = [&](std::vector<tms::GenMat> const &matrices, tms::BasicInt q) {
+		std::vector<tms::BasicInt> parts(matrices.size(), 0);
+		std::function<bool (std::size_t, tms::BasicInt)> check = [&](std::size_t dim, tms::BasicInt rest) {
+			if ( dim + 1 == matrices.size() )
+			{
+				parts[dim] = rest;
+				std::vector<uint64_t> rows;
+				for (std::size_t i = 0; i < matrices.size(); ++i)
+				{
+					for (tms::BasicInt row_i = 0; row_i < parts[i]; ++row_i)
+					{
+						rows.push_back(matrices[i][row_i].bits());
+					}
+				}
+				return rank(rows) == q;
+			}
+			for (parts[dim] = 0; parts[dim] <= rest; ++parts[dim])
+			{
+				if ( !check(dim + 1, rest - parts[dim]) )
+				{ return false; }
+			}
+			return true;
+		};
+		return check(0, q);
+	};
+
+	std::mt19937_64 engine(20211012);
+	for (int trial = 0; trial < 40; ++trial)
+	{
+		tms::BasicInt const m = 3 + engine() % 6;
+		tms::BasicInt const s = 2 + engine() % 4;
+		tms::DigitalNet const    net = random_net(m, s, engine);
+		std::vector<tms::GenMat> matrices;
+		for (tms::BasicInt dim = 0; dim < s; ++dim)
+		{
+			matrices.push_back(net.generating_matrix(dim));
+		}
+		tms::BasicInt expected_t = 0;
+		while ( !is_net_with(matrices, m - expected_t) )
+		{
+			++expected_t;
+		}
+		CHECK( tms::analysis::t(net) == expected_t );
+	}
+
+	CHECK( tms::analysis::t(tms::Sobol(16, 6)) == 6 );
+}
+
+TEST_CASE("Validation of t-values of projections", "[analysis][DigitalNet]")
+{
+	for (tms::DigitalNet const &net : {tms::DigitalNet(tms::Sobol(10, 6)), tms::DigitalNet(tms::Niederreiter(9, 5))})
+	{
+		tms::analysis::TProjections const projections = tms::analysis::t_projections(net, net.s());
+
+		REQUIRE( projections.max_order() == net.s() );
+		CHECK( projections.values[net.s() - 1].size() == 1 );
+		CHECK( projections.max_t(net.s()) == tms::analysis::t(net) );
+		for (tms::BasicInt order = 1; order <= net.s(); ++order)
+		{
+			for (tms::CountInt index = 0; index < projections.values[order - 1].size(); ++index)
+			{
+				std::vector<tms::BasicInt> const coordinates = projections.coordinates(order, index);
+				REQUIRE( projections.index(coordinates) == index );
+
+				std::vector<tms::GenMat> matrices;
+				for (tms::BasicInt dim : coordinates)
+				{
+					matrices.push_back(net.generating_matrix(dim));
+				}
+				CHECK( projections.t(coordinates) == tms::analysis::t(tms::DigitalNet(matrices)) );
+			}
+		}
+	}
+
+	tms::analysis::TProjections const projections = tms::analysis::t_projections(tms::Sobol(12, 6), 2);
+	CHECK( projections.values[1].size() == 15 );
+	CHECK( projections.mean_t(1) == 0 );
+	CHECK_THROWS_AS( projections.t({3, 2}), std::out_of_range );
+	CHECK_THROWS_AS( tms::analysis::t_projections(tms::Sobol(12, 6), 7), std::invalid_argument );
+}
+
+TEST_CASE("Validation of scatter defect", "[analysis][DigitalNet]")
+{
+	tms::Niederreiter const net(10, 4);
+	tms::BasicInt const     s = net.s();
+
+	// defect is lambda_i^2/(sum of lambda^2) - 1/s for eigenvalues lambda of the covariance matrix, which are
+	// nonnegative, sum of their squares is the squared Frobenius norm and their sum is the trace
+	std::vector<tms::Real> covariance(s*s, 0);
+	for (tms::CountInt point_i = 0; point_i < (1ULL << net.m()); ++point_i)
+	{
+		tms::Point const point = net.generate_point(point_i);
+		for (tms::BasicInt i = 0; i < s; ++i)
+			for (tms::BasicInt j = 0; j < s; ++j)
+				covariance[i*s + j] += (point[i] - 0.5)*(point[j] - 0.5);
+	}
+
+	tms::Real squared_norm = 0;
+	tms::Real trace        = 0;
+	for (tms::BasicInt i = 0; i < s; ++i)
+	{
+		trace += covariance[i*s + i];
+		for (tms::BasicInt j = 0; j < s; ++j)
+			squared_norm += covariance[i*s + j]*covariance[i*s + j];
+	}
+
+	tms::Point const defect = tms::analysis::scatter_defect(net);
+	REQUIRE( defect.size() == s );
+	tms::Real eigenvalues_sum = 0;
+	for (tms::Real value : defect)
+	{
+		REQUIRE( value >= -1.0L/s );
+		eigenvalues_sum += std::sqrt((value + 1.0L/s)*squared_norm);
+	}
+	CHECK( std::abs(eigenvalues_sum - trace) < 1e-9*trace );
+	// parts of the net and the order of their reduction depend on the amount of threads, sums are exact
+	CHECK( defect == tms::analysis::scatter_defect(net, 1) );
+	CHECK( defect == tms::analysis::scatter_defect(net, 3) );
+	CHECK( tms::analysis::scatter_defect(net, 1) == tms::analysis::scatter_defect(net, 7) );
+
+	// a net with m = 0 is the origin alone, its covariance matrix is filled with 1/4 and has the only eigenvalue 3/4
+	tms::Point single = tms::analysis::scatter_defect(tms::DigitalNet(std::vector<tms::GenNum>(3, tms::GenNum())));
+	REQUIRE( single.size() == 3 );
+	std::sort(single.begin(), single.end());
+	CHECK( std::abs(single[0] + 1.0L/3) < 1e-12 );
+	CHECK( std::abs(single[1] + 1.0L/3) < 1e-12 );
+	CHECK( std::abs(single[2] - 2.0L/3) < 1e-12 );
+}
+
+TEST_CASE("Validation of exact sums of products", "[details][bitops]")
+{
+	auto words = [](tms::bitops::ExactSum const &sum) {
+		return std::vector<uint64_t>{sum.word(0), sum.word(1), sum.word(2)};
+	};
+	uint64_t const ones = ~0ULL;
+
+	SECTION("Carries between words")
+	{
+		// (2^64 - 1)^2 = 2^128 - 2^65 + 1
+		tms::bitops::ExactSum sum;
+		sum.add_product(ones, ones);
+		CHECK( words(sum) == std::vector<uint64_t>{1, ones - 1, 0} );
+		sum.add_product(ones, ones);
+		CHECK( words(sum) == std::vector<uint64_t>{2, ones - 3, 1} );
+
+		tms::bitops::ExactSum carried;
+		carried.add(ones, ones, 0);
+		carried.add(1, 0, 0);
+		CHECK( words(carried) == std::vector<uint64_t>{0, 0, 1} );
+		carried += sum;
+		CHECK( words(carried) == std::vector<uint64_t>{2, ones - 3, 2} );
+	}
+
+	SECTION("Negation and subtraction")
+	{
+		tms::bitops::ExactSum one;
+		one.add_product(1, 1);
+		tms::bitops::ExactSum minus_one;
+		minus_one -= one;
+		CHECK( words(minus_one) == std::vector<uint64_t>{ones, ones, ones} );
+		CHECK( minus_one.value(0) == -1 );
+
+		tms::bitops::ExactSum power;
+		power.add_product(1ULL << 32, 1ULL << 32);
+		tms::bitops::ExactSum minus_power;
+		minus_power -= power;
+		CHECK( words(minus_power) == std::vector<uint64_t>{0, ones, ones} );
+		CHECK( minus_power.value(0) == -std::ldexp(1.0L, 64) );
+		minus_power += power;
+		CHECK( words(minus_power) == std::vector<uint64_t>{0, 0, 0} );
+
+		// 2^130 + 2^70 - 2^128 = 3*2^128 + 2^70
+		tms::bitops::ExactSum large;
+		large.add(0, 1ULL << 6, 4);
+		tms::bitops::ExactSum high;
+		high.add(0, 0, 1);
+		large -= high;
+		CHECK( large.value(0) == std::ldexp(3.0L, 128) + std::ldexp(1.0L, 70) );
+		high -= large;
+		CHECK( high.value(70) == -std::ldexp(1.0L, 59) - 1 );
+	}
+
+	SECTION("Multiplication by powers of two")
+	{
+		tms::bitops::ExactSum sum;
+		sum.add(1ULL << 63, 1ULL << 63, 0);
+		sum <<= 1;
+		CHECK( words(sum) == std::vector<uint64_t>{0, 1, 1} );
+		sum <<= 0;
+		CHECK( words(sum) == std::vector<uint64_t>{0, 1, 1} );
+		sum <<= 63;
+		CHECK( words(sum) == std::vector<uint64_t>{0, 1ULL << 63, 1ULL << 63} );
+
+		tms::bitops::ExactSum three;
+		three.add_product(3, 1);
+		tms::bitops::ExactSum minus_three;
+		minus_three -= three;
+		minus_three <<= 4;
+		CHECK( minus_three.value(2) == -12 );
+	}
+}
+
+TEST_CASE("Validation of L2-star discrepancy", "[analysis][DigitalNet]")
+{
+	// points i/N of a one-dimensional net have the discrepancy 1/(sqrt(3) N)
+	CHECK( std::abs(tms::analysis::l2_star_discrepancy(tms::Sobol(10, 1))*std::sqrt(3.0L)*1024 - 1) < 1e-12 );
+
+	// small dimensions are handled by divide and conquer, large ones by Warnock's formula directly
+	for (tms::DigitalNet const &net : {tms::DigitalNet(tms::Sobol(12, 2)), tms::DigitalNet(tms::Niederreiter(12, 3)),
+	                                   tms::DigitalNet(tms::Sobol(10, 6)), tms::DigitalNet(tms::Niederreiter(10, 5))})
+	{
+		tms::CountInt const    point_count = 1ULL << net.m();
+		std::vector<tms::Point> points;
+		for (tms::CountInt point_i = 0; point_i < point_count; ++point_i)
+			points.push_back(net.generate_point(point_i));
+
+		tms::Real squares = 0;
+		tms::Real pairs   = 0;
+		for (tms::Point const &a : points)
+		{
+			tms::Real square_product = 1;
+			for (tms::BasicInt k = 0; k < net.s(); ++k)
+				square_product *= 1 - a[k]*a[k];
+			squares += square_product;
+			for (tms::Point const &b : points)
+			{
+				tms::Real pair_product = 1;
+				for (tms::BasicInt k = 0; k < net.s(); ++k)
+					pair_product *= 1 - std::max(a[k], b[k]);
+				pairs += pair_product;
+			}
+		}
+		tms::Real const expected = std::sqrt(std::pow(3.0L, -static_cast<int>(net.s())) - 2*std::pow(2.0L, -static_cast<int>(net.s()))*squares/point_count
+		                                     + pairs/point_count/point_count);
+
+		tms::Real const discrepancy = tms::analysis::l2_star_discrepancy(net);
+		CHECK( std::abs(discrepancy - expected) < 1e-9*expected );
+		CHECK( discrepancy == tms::analysis::l2_star_discrepancy(net) );
+	}
+}
+
+TEST_CASE("Validation of equidistribution verification", "[analysis][DigitalNet]")
+{
+	std::mt19937_64 engine(20211101);
+	for (int trial = 0; trial < 20; ++trial)
+	{
+		tms::BasicInt const m = 6 + engine() % 5;
+		tms::BasicInt const s = 2 + engine() % 4;
+		tms::DigitalNet const net = random_net(m, s, engine);
+		tms::BasicInt const   t = tms::analysis::t(net);
+
+		CHECK( tms::analysis::verify_equidistribution(net, t).equidistributed );
+		if ( t == 0 )
+		{ continue; }
+
+		tms::analysis::EquidistributionReport const report = tms::analysis::verify_equidistribution(net, t - 1);
+		REQUIRE( !report.equidistributed );
+		tms::analysis::ElementaryInterval const &interval = report.counterexample;
+		REQUIRE( interval.digits.size() == s );
+		REQUIRE( interval.positions.size() == s );
+		tms::BasicInt digits = 0;
+		for (tms::BasicInt d : interval.digits)
+		{ digits += d; }
+		CHECK( digits == m - t + 1 );
+		CHECK( interval.points != (1ULL << (t - 1)) );
+
+		tms::CountInt points = 0;
+		for (tms::CountInt point_i = 0; point_i < (1ULL << m); ++point_i)
+		{
+			tms::IntPoint const point  = net.generate_int_point(point_i);
+			bool                inside = true;
+			for (tms::BasicInt k = 0; k < s; ++k)
+			{
+				inside = inside && (point[k] >> (m - interval.digits[k])) == interval.positions[k];
+			}
+			points += inside;
+		}
+		CHECK( points == interval.points );
+	}
+
+	CHECK( tms::analysis::verify_equidistribution(tms::Sobol(12, 6), 12).equidistributed );
+	CHECK_THROWS_AS( tms::analysis::verify_equidistribution(tms::Sobol(12, 6), 13), std::invalid_argument );
 }
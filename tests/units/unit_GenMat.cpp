@@ -0,0 +1,134 @@
+/**
+ * \file
+ *       unit_GenMat.cpp
+ */
+#include "../catch2/catch_amalgamated.hpp"
+#include "../../include/tms-nets.hpp"
+#include "random_nets.hpp"
+
+#include <random>
+
+
+
+
+
+TEST_CASE("Validation of GenMat class", "[details][GenMat]")
+{
+	std::mt19937_64 engine(20211004);
+	auto random_matrix = [&](tms::BasicInt size) {
+		tms::GenMat matrix(size);
+		for (tms::BasicInt i = 0; i < size; ++i)
+		{
+			for (tms::BasicInt j = 0; j < size; ++j)
+			{
+				matrix[i][j] = engine() & 1;
+			}
+		}
+		return matrix;
+	};
+
+	SECTION("Check elements of packed rows")
+	{
+		tms::GenMatRow row{1, 0, 1, 1};
+		CHECK( row.size() == 4 );
+		CHECK( row.bits() == 0xB );
+		CHECK( row[0] == 1 );
+		CHECK( row[1] == 0 );
+		row[1] = 1;
+		row[0] ^= 1;
+		CHECK( row == tms::GenMatRow{0, 1, 1, 1} );
+		CHECK( (row >> 1) == tms::GenMatRow{0, 0, 1, 1} );
+		CHECK( (row << 1) == tms::GenMatRow{1, 1, 1, 0} );
+		CHECK( (row ^ tms::GenMatRow{1, 1, 0, 0}) == tms::GenMatRow{1, 0, 1, 1} );
+		CHECK_THROWS( row ^ tms::GenMatRow{1, 1, 0} );
+		CHECK( tms::GenMatRow::from_bits(64, ~0ULL)[63] == 1 );
+	}
+
+	SECTION("Multiplication and inversion agree with elementwise computations")
+	{
+		for (tms::BasicInt size : {1U, 5U, 8U, 17U, 31U, 64U})
+		{
+			tms::GenMat const a = random_matrix(size);
+			tms::GenMat const b = random_matrix(size);
+			tms::GenMat const product = a * b;
+			bool equal = true;
+			for (tms::BasicInt i = 0; i < size; ++i)
+			{
+				for (tms::BasicInt j = 0; j < size; ++j)
+				{
+					uint8_t element = 0;
+					for (tms::BasicInt k = 0; k < size; ++k)
+					{
+						element ^= a[i][k] & b[k][j];
+					}
+					equal = equal && product[i][j] == element;
+				}
+			}
+			CHECK( equal );
+
+			tms::GenMat const invertible = random_nondegenerate_matrix(size, engine);
+			CHECK( invertible.inverse() * invertible == tms::genmat::eye(size) );
+			CHECK( invertible * invertible.inverse() == tms::genmat::eye(size) );
+		}
+		CHECK_THROWS_AS( tms::GenMat(3).inverse(), std::logic_error );
+		REQUIRE_THROWS_AS( random_matrix(4) * random_matrix(40), std::length_error );
+		REQUIRE_THROWS_AS( tms::GenNum(4) * tms::GenNum(40), std::length_error );
+		REQUIRE_THROWS_AS( tms::GenNum(40) * tms::GenNum(4), std::length_error );
+	}
+
+	SECTION("Batched multiplication agrees with multiplication of every matrix")
+	{
+		for (tms::BasicInt size : {3U, 20U, 64U})
+		{
+			tms::GenMat const left  = random_matrix(size);
+			tms::GenMat const right = random_matrix(size);
+			std::vector<tms::GenNum> generating_numbers;
+			for (int dim = 0; dim < 5; ++dim)
+			{
+				generating_numbers.emplace_back(random_matrix(size));
+			}
+			std::vector<tms::GenNum> const left_products  = tms::genmat::multiply_left(left, generating_numbers);
+			std::vector<tms::GenNum> const right_products = tms::genmat::multiply_right(generating_numbers, right);
+			REQUIRE( left_products.size() == generating_numbers.size() );
+			REQUIRE( right_products.size() == generating_numbers.size() );
+			for (std::size_t dim = 0; dim < generating_numbers.size(); ++dim)
+			{
+				tms::GenMat const matrix(generating_numbers[dim]);
+				CHECK( tms::GenMat(left_products[dim]) == left * matrix );
+				CHECK( tms::GenMat(right_products[dim]) == matrix * right );
+				CHECK( generating_numbers[dim] * tms::GenNum(right) == right_products[dim] );
+			}
+		}
+		CHECK_THROWS( tms::genmat::multiply_left(random_matrix(4), {tms::GenNum(5)}) );
+	}
+
+	SECTION("Conversions between generating numbers and matrices")
+	{
+		for (tms::BasicInt size : {1U, 7U, 32U, 64U})
+		{
+			tms::GenMat const matrix = random_matrix(size);
+			tms::GenNum const numbers(matrix);
+			bool equal = true;
+			for (tms::BasicInt i = 0; i < size; ++i)
+			{
+				for (tms::BasicInt j = 0; j < size; ++j)
+				{
+					equal = equal && numbers.get_bit(i, j) == (matrix[i][j] == 1);
+				}
+			}
+			CHECK( equal );
+			CHECK( tms::GenMat(numbers) == matrix );
+			CHECK( tms::GenNum(tms::GenMat(numbers) * tms::genmat::eye(size)) == numbers );
+		}
+	}
+
+	SECTION("Toeplitz matrices")
+	{
+		tms::GenMat const toeplitz{tms::GenMatRow{1, 0, 1, 1}, tms::GenMatRow{0, 1, 0, 1}, tms::GenMatRow{1, 0, 1, 0}, tms::GenMatRow{0, 1, 0, 1}};
+		CHECK( toeplitz.is_toeplitz() );
+		CHECK( tms::genmat::eye(4).is_toeplitz() );
+		tms::GenMat broken = toeplitz;
+		broken[3][3] = 0;
+		CHECK_FALSE( broken.is_toeplitz() );
+	}
+}
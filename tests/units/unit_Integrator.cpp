@@ -0,0 +1,81 @@
+/**
+ * \file
+ *       unit_Integrator.cpp
+ */
+#include "../catch2/catch_amalgamated.hpp"
+#include "../../include/tms-nets.hpp"
+
+#include <cmath>
+#include <tuple>
+
+
+
+
+
+TEST_CASE("Validation of Integrator class", "[qmc][Integrator]")
+{
+	tms::Sobol const net(12, 4);
+
+	SECTION("Constant functions are integrated exactly")
+	{
+		tms::qmc::Estimate const estimate = tms::qmc::Integrator(net, 8).integrate([](double const *, std::size_t count, double *values) {
+			for (std::size_t n = 0; n < count; ++n)
+			{ values[n] = 1; }
+		});
+		REQUIRE( estimate.replicates.size() == 8 );
+		CHECK( estimate.mean == 1 );
+		CHECK( estimate.standard_error == 0 );
+		CHECK( estimate.lower == 1 );
+		CHECK( estimate.upper == 1 );
+	}
+
+	SECTION("Estimates are unbiased and reproducible")
+	{
+		// the integral of the product of 3 x_k^2 over the unit cube is 1
+		tms::BasicInt const s         = net.s();
+		tms::qmc::Integrand integrand = [s](double const *points, std::size_t count, double *values) {
+			for (std::size_t n = 0; n < count; ++n)
+			{
+				values[n] = 1;
+				for (tms::BasicInt k = 0; k < s; ++k)
+				{ values[n] *= 3*points[n*s + k]*points[n*s + k]; }
+			}
+		};
+		tms::qmc::Integrator const integrator(net, 16, 20211101, 100);
+		tms::qmc::Estimate const   estimate = integrator.integrate(integrand, 0.99);
+		CHECK( estimate.standard_error > 0 );
+		CHECK( estimate.standard_error < 1e-3 );
+		CHECK( estimate.lower < 1 );
+		CHECK( estimate.upper > 1 );
+
+		CHECK( integrator.integrate(integrand, 0.99).replicates == estimate.replicates );
+		CHECK( tms::qmc::Integrator(net, 16, 20211102, 100).integrate(integrand, 0.99).replicates != estimate.replicates );
+		// blocks only change the order of summation
+		tms::qmc::Estimate const blocked = tms::qmc::Integrator(net, 16, 20211101, 4096).integrate(integrand, 0.99);
+		for (tms::BasicInt replicate_i = 0; replicate_i < 16; ++replicate_i)
+		{
+			CHECK( std::abs(blocked.replicates[replicate_i] - estimate.replicates[replicate_i]) < 1e-15 );
+		}
+	}
+
+	SECTION("Confidence intervals follow Student's distribution")
+	{
+		tms::qmc::Integrand const first_coordinate = [&net](double const *points, std::size_t count, double *values) {
+			for (std::size_t n = 0; n < count; ++n)
+			{ values[n] = points[n*net.s()]; }
+		};
+		// quantiles of Student's distribution with 1 and 10 degrees of freedom
+		for (auto [replicates, confidence, quantile] : {std::tuple<tms::BasicInt, tms::Real, tms::Real>{2, 0.95, 12.706204736174707},
+		                                                std::tuple<tms::BasicInt, tms::Real, tms::Real>{11, 0.9, 1.8124611228107335}})
+		{
+			tms::qmc::Estimate const estimate = tms::qmc::Integrator(net, replicates).integrate(first_coordinate, confidence);
+			REQUIRE( estimate.standard_error > 0 );
+			CHECK( std::abs((estimate.upper - estimate.mean)/estimate.standard_error - quantile) < 1e-9*quantile );
+			CHECK( std::abs((estimate.mean - estimate.lower)/estimate.standard_error - quantile) < 1e-9*quantile );
+		}
+	}
+
+	CHECK_THROWS_AS( tms::qmc::Integrator(net, 1), std::invalid_argument );
+	CHECK_THROWS_AS( tms::qmc::Integrator(net, 2, 0, 0), std::invalid_argument );
+	CHECK_THROWS_AS( tms::qmc::Integrator(net, 2).integrate([](double const *, std::size_t, double *){}, 1), std::invalid_argument );
+}
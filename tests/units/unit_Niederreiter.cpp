@@ -8,6 +8,8 @@
 #include "../catch2/catch_amalgamated.hpp"
 #include "../../include/tms-nets.hpp"
 
+#include <thread>
+
 
 
 
@@ -131,3 +133,150 @@ TEST_CASE("Validation of Niederreiter class, polynomial constructor", "[nets][Ni
 		REQUIRE( nondeg_net.t_estimate() == 5 );
 	}
 }
+
+
+
+TEST_CASE("Validation of Niederreiter class, parallel generation of irreducible polynomials", "[nets][Niederreiter]")
+{
+	// repeated construction checks that parallel generation does not depend on previous calls
+	for (int attempt = 0; attempt < 2; ++attempt)
+	{
+		tms::Niederreiter serial_net(20, 9);
+		tms::Niederreiter parallel_net(20, 9, true);
+		REQUIRE( parallel_net.s() == serial_net.s() );
+		for (tms::BasicInt dim = 0; dim < serial_net.s(); ++dim)
+		{
+			CHECK( parallel_net.generating_numbers(dim) == serial_net.generating_numbers(dim) );
+		}
+	}
+}
+
+
+
+TEST_CASE("Validation of Sobol class, parallel construction of generating matrices", "[nets][Sobol]")
+{
+	for (tms::BasicInt nbits : {32, 63, 64})
+	{
+		tms::Sobol serial_net(nbits, 12);
+		tms::Sobol parallel_net(nbits, 12, true);
+		REQUIRE( parallel_net.s() == serial_net.s() );
+		for (tms::BasicInt dim = 0; dim < serial_net.s(); ++dim)
+		{
+			CHECK( parallel_net.generating_numbers(dim) == serial_net.generating_numbers(dim) );
+		}
+		CHECK( parallel_net.generate_int_point(12345) == serial_net.generate_int_point(12345) );
+	}
+}
+
+
+
+TEST_CASE("Validation of packed linear recurring sequences", "[details][recseq]")
+{
+	// characteristic polynomials of degrees 5, 64 and 70, the last one doesn't fit into a word
+	std::vector<tms::Polynomial> const char_polys = {
+		tms::Polynomial(0x25),
+		(tms::Polynomial(1) << 64) + tms::Polynomial(0x1B),
+		(tms::Polynomial(1) << 70) + (tms::Polynomial(0x9D) << 60) + tms::Polynomial(0x43)
+	};
+
+	for (tms::Polynomial const &char_poly : char_polys)
+	{
+		tms::CountInt const deg = char_poly.degree();
+		for (tms::CountInt count : {deg - 1, deg + 100, 64*deg + 200})
+		{
+			uintmax_t const init_values = 0x9E3779B97F4A7C15ULL;
+
+			// term by term computation with the definition of the recurrence
+			std::vector<tms::BasicInt> expected(count);
+			for (tms::CountInt seq_i = 0; seq_i < count; ++seq_i)
+			{
+				if ( seq_i < deg )
+				{
+					expected[seq_i] = seq_i < 64 ? (init_values >> seq_i) & 1 : 0;
+					continue;
+				}
+				for (tms::CountInt poly_i = 0; poly_i < deg; ++poly_i)
+				{
+					expected[seq_i] ^= char_poly[poly_i] & expected[seq_i - deg + poly_i];
+				}
+			}
+
+			std::vector<uint64_t> words;
+			tms::recseq::fill_words_recursively(words, count, init_values, char_poly);
+			REQUIRE( words.size() == (count + 63)/64 );
+			bool all_match = true;
+			for (tms::CountInt seq_i = 0; seq_i < count; ++seq_i)
+			{
+				all_match = all_match && ((words[seq_i/64] >> (seq_i % 64)) & 1) == expected[seq_i];
+			}
+			CHECK( all_match );
+			CHECK( tms::recseq::extract_terms(words, deg - 1, 10) == (tms::recseq::extract_terms(words, deg - 3, 12) >> 2) );
+
+			std::vector<tms::BasicInt> unpacked(count);
+			tms::recseq::fill_vector_recursively(unpacked, init_values, char_poly);
+			CHECK( unpacked == expected );
+		}
+	}
+}
+
+
+
+TEST_CASE("Validation of enumeration of irreducible polynomials", "[details][gf2poly]")
+{
+	SECTION("Amounts of irreducible polynomials of each degree")
+	{
+		// degrees 13 and 14 are taken from the precomputed table, the others are sieved
+		std::vector<std::size_t> const counts = {630, 1161, 2182, 4080, 7710, 14532};
+		for (unsigned int degree = 13; degree <= 18; ++degree)
+		{
+			CHECK( tms::gf2poly::irreducible_masks_of_degree(degree).size() == counts[degree - 13] );
+		}
+		CHECK( tms::gf2poly::irreducible_masks(18).size() == 2538 + 2182 + 4080 + 7710 + 14532 );
+	}
+
+	SECTION("Enumerated polynomials are the ones checked one by one")
+	{
+		std::vector<uint64_t> const masks = tms::gf2poly::first_irreducible_masks(6000);
+		REQUIRE( masks.size() == 6000 );
+		std::vector<uint64_t> expected = {2};
+		for (uint64_t coeffs_number = 3; expected.size() < masks.size(); coeffs_number += 2)
+		{
+			if ( tms::is_irreducible(tms::Polynomial(coeffs_number)) )
+			{
+				expected.push_back(coeffs_number);
+			}
+		}
+		CHECK( masks == expected );
+
+		std::vector<tms::Polynomial> const irrpolys = tms::gf2poly::generate_irrpolys(100, 40);
+		REQUIRE( irrpolys.size() == 14 );
+		for (std::size_t i = 0; i < irrpolys.size(); ++i)
+		{
+			CHECK( irrpolys[i] == tms::Polynomial(expected[i]) );
+		}
+		CHECK( tms::gf2poly::generate_irrpolys_until_degree(5).size() == 2 + 1 + 2 + 3 );
+	}
+
+	SECTION("Parallel enumeration gives the same polynomials in every call")
+	{
+		std::vector<uint64_t> const masks = tms::gf2poly::first_irreducible_masks(20000);
+		CHECK( tms::gf2poly::first_irreducible_masks(20000, ~0U, true) == masks );
+		CHECK( tms::gf2poly::first_irreducible_masks(20000, ~0U, true) == masks );
+
+		std::vector< std::vector<tms::Polynomial> > results(4);
+		std::vector<std::thread>                    threads;
+		for (std::size_t thread_i = 0; thread_i < results.size(); ++thread_i)
+		{
+			threads.emplace_back([&results, thread_i] { results[thread_i] = tms::gf2poly::generate_irrpolys_in_parallel(20000); });
+		}
+		for (std::thread &thread : threads)
+		{
+			thread.join();
+		}
+		std::vector<tms::Polynomial> const expected = tms::gf2poly::generate_irrpolys(20000);
+		for (std::vector<tms::Polynomial> const &irrpolys : results)
+		{
+			CHECK( irrpolys == expected );
+		}
+	}
+}
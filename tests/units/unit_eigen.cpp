@@ -0,0 +1,74 @@
+/**
+ * \file
+ *       unit_eigen.cpp
+ */
+#include "../catch2/catch_amalgamated.hpp"
+#include "../../include/tms-nets.hpp"
+#include "../../include/tms-nets/details/eigen.hpp"
+#include "../../include/tms-nets/thirdparty/jacobi/jacobi.hpp"
+
+#include <cmath>
+#include <random>
+
+
+
+
+
+TEST_CASE("Validation of symmetric eigenvalues", "[details][eigen]")
+{
+	SECTION("Eigenvalues of the second difference matrix are known")
+	{
+		// tridiagonal (-1, 2, -1) matrix has eigenvalues 2 - 2 cos(k pi/(n + 1)) for k from 1 to n
+		for (std::size_t size : {1, 2, 3, 10, 300})
+		{
+			std::vector<double> matrix(size*size, 0);
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				matrix[i*size + i] = 2;
+				if ( i + 1 < size )
+				{
+					matrix[i*size + i + 1] = matrix[(i + 1)*size + i] = -1;
+				}
+			}
+			std::vector<double> const eigenvalues = tms::eigen::symmetric_eigenvalues(matrix, size);
+			REQUIRE( eigenvalues.size() == size );
+			for (std::size_t k = 1; k <= size; ++k)
+			{
+				CHECK( std::abs(eigenvalues[size - k] - (2 - 2*std::cos(k*std::acos(-1.0)/(size + 1)))) < 1e-12 );
+			}
+		}
+	}
+
+	SECTION("Eigenvalues agree with Jacobi's method")
+	{
+		using Row    = std::vector<double>;
+		using Matrix = std::vector<Row>;
+
+		std::mt19937_64                        engine(20211018);
+		std::uniform_real_distribution<double> element(-1, 1);
+		for (std::size_t size : {4, 17, 65})
+		{
+			std::vector<double> matrix(size*size);
+			Matrix              rows(size, Row(size));
+			for (std::size_t i = 0; i < size; ++i)
+			{
+				for (std::size_t j = 0; j <= i; ++j)
+				{
+					matrix[i*size + j] = matrix[j*size + i] = rows[i][j] = rows[j][i] = element(engine);
+				}
+			}
+			Row    expected(size);
+			Matrix vectors(size, Row(size));
+			jacobi_public_domain::Jacobi<double, Row &, Matrix &> diagonaliser(static_cast<int>(size));
+			diagonaliser.Diagonalize(rows, expected, vectors);
+
+			std::vector<double> const eigenvalues = tms::eigen::symmetric_eigenvalues(matrix, size);
+			for (std::size_t k = 0; k < size; ++k)
+			{
+				CHECK( std::abs(eigenvalues[k] - expected[k]) < 1e-10 );
+			}
+		}
+	}
+
+	CHECK_THROWS_AS( tms::eigen::symmetric_eigenvalues(std::vector<double>(5), 2), std::length_error );
+}